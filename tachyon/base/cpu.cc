@@ -0,0 +1,150 @@
+// Copyright 2012 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/cpu.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <utility>
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/build/build_config.h"
+
+namespace tachyon::base {
+
+CPU::CPU() : CPU(true) {}
+
+CPU::CPU(bool requires_branding) { Initialize(requires_branding); }
+
+CPU::CPU(CPU&&) = default;
+
+namespace {
+
+#if defined(ARCH_CPU_X86_FAMILY)
+
+// Inline assembly is used rather than <cpuid.h>, so that the subleaf is always
+// zeroed, which leaf 7 requires.
+void __cpuid(int cpu_info[4], int info_type) {
+  __asm__ volatile("cpuid\n"
+                   : "=a"(cpu_info[0]), "=b"(cpu_info[1]), "=c"(cpu_info[2]),
+                     "=d"(cpu_info[3])
+                   : "a"(info_type), "c"(0));
+}
+
+// _xgetbv returns the value of an Intel Extended Control Register (XCR).
+// Currently only XCR0 is defined by Intel so |xcr| should always be zero.
+uint64_t xgetbv(uint32_t xcr) {
+  uint32_t eax, edx;
+
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(xcr));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+#endif  // defined(ARCH_CPU_X86_FAMILY)
+
+}  // namespace
+
+void CPU::Initialize(bool requires_branding) {
+#if defined(ARCH_CPU_X86_FAMILY)
+  int cpu_info[4] = {-1};
+  // This array is used to temporarily hold the vendor name and then the brand
+  // name. Thus it has to be big enough for both use cases. There are
+  // static_asserts below for each of the use cases to make sure this array is
+  // big enough.
+  char cpu_string[sizeof(cpu_info) * 3 + 1];
+
+  // __cpuid with an InfoType argument of 0 returns the number of
+  // valid Ids in CPUInfo[0] and the CPU identification string in
+  // the other three array elements. The CPU identification string is
+  // not in linear order. The code below arranges the information
+  // in a human readable form. The human readable order is CPUInfo[1] |
+  // CPUInfo[3] | CPUInfo[2]. CPUInfo[2] and CPUInfo[3] are swapped
+  // before using memcpy() to copy these three array elements to |cpu_string|.
+  __cpuid(cpu_info, 0);
+  int num_ids = cpu_info[0];
+  std::swap(cpu_info[2], cpu_info[3]);
+  static constexpr size_t kVendorNameSize = 3 * sizeof(cpu_info[1]);
+  static_assert(kVendorNameSize < sizeof(cpu_string) / sizeof(cpu_string[0]),
+                "cpu_string too small");
+  memcpy(cpu_string, &cpu_info[1], kVendorNameSize);
+  cpu_string[kVendorNameSize] = '\0';
+  cpu_vendor_ = cpu_string;
+
+  // Interpret CPU feature information.
+  if (num_ids > 0) {
+    int cpu_info7[4] = {0};
+    __cpuid(cpu_info, 1);
+    if (num_ids >= 7) {
+      __cpuid(cpu_info7, 7);
+    }
+    signature_ = cpu_info[0];
+    stepping_ = cpu_info[0] & 0xf;
+    type_ = (cpu_info[0] >> 12) & 0x3;
+    ext_model_ = (cpu_info[0] >> 16) & 0xf;
+    ext_family_ = (cpu_info[0] >> 20) & 0xff;
+    family_ = (cpu_info[0] >> 8) & 0xf;
+    model_ = ((cpu_info[0] >> 4) & 0xf) + (ext_model_ << 4);
+    has_mmx_ = (cpu_info[3] & 0x00800000) != 0;
+    has_sse_ = (cpu_info[3] & 0x02000000) != 0;
+    has_sse2_ = (cpu_info[3] & 0x04000000) != 0;
+    has_sse3_ = (cpu_info[2] & 0x00000001) != 0;
+    has_ssse3_ = (cpu_info[2] & 0x00000200) != 0;
+    has_sse41_ = (cpu_info[2] & 0x00080000) != 0;
+    has_sse42_ = (cpu_info[2] & 0x00100000) != 0;
+    has_popcnt_ = (cpu_info[2] & 0x00800000) != 0;
+
+    // "Hypervisors may also use the XSAVE and OSXSAVE bits to hide AVX support
+    // even though the processor is capable of it." So AVX is only usable when
+    // the OS has enabled saving the YMM state, which is reported by XCR0.
+    bool os_saves_ymm = (cpu_info[2] & 0x08000000) != 0 &&
+                        (cpu_info[2] & 0x04000000) != 0 &&
+                        (xgetbv(0) & 6) == 6;
+    // Likewise, AVX-512 is only usable when the OS saves the opmask and ZMM
+    // states as well.
+    bool os_saves_zmm = os_saves_ymm && (xgetbv(0) & 0xe6) == 0xe6;
+    has_avx_ = os_saves_ymm && (cpu_info[2] & 0x10000000) != 0;
+    has_fma3_ = has_avx_ && (cpu_info[2] & 0x00001000) != 0;
+    has_avx2_ = has_avx_ && (cpu_info7[1] & 0x00000020) != 0;
+    has_bmi2_ = (cpu_info7[1] & 0x00000100) != 0;
+    has_adx_ = (cpu_info7[1] & 0x00080000) != 0;
+    has_avx512f_ = os_saves_zmm && (cpu_info7[1] & 0x00010000) != 0;
+    has_avx512dq_ = has_avx512f_ && (cpu_info7[1] & 0x00020000) != 0;
+    has_avx512ifma_ = has_avx512f_ && (cpu_info7[1] & 0x00200000) != 0;
+    has_avx512vl_ = has_avx512f_ && (cpu_info7[1] & 0x80000000) != 0;
+  }
+
+  // Get the brand string of the cpu.
+  __cpuid(cpu_info, static_cast<int>(0x80000000));
+  const uint32_t max_parameter = static_cast<uint32_t>(cpu_info[0]);
+
+  static constexpr uint32_t kParameterStart = 0x80000002;
+  static constexpr uint32_t kParameterEnd = 0x80000004;
+  static constexpr uint32_t kParameterSize =
+      kParameterEnd - kParameterStart + 1;
+  static_assert(kParameterSize * sizeof(cpu_info) + 1 ==
+                    sizeof(cpu_string) / sizeof(cpu_string[0]),
+                "cpu_string has wrong size");
+
+  if (requires_branding && max_parameter >= kParameterEnd) {
+    size_t i = 0;
+    for (uint32_t parameter = kParameterStart; parameter <= kParameterEnd;
+         ++parameter) {
+      __cpuid(cpu_info, static_cast<int>(parameter));
+      memcpy(&cpu_string[i], cpu_info, sizeof(cpu_info));
+      i += sizeof(cpu_info);
+    }
+    cpu_string[i] = '\0';
+    cpu_brand_ = cpu_string;
+  }
+#endif  // defined(ARCH_CPU_X86_FAMILY)
+}
+
+// static
+const CPU& CPU::GetInstanceNoAllocation() {
+  static const NoDestructor<const CPU> cpu(CPU(false));
+  return *cpu;
+}
+
+}  // namespace tachyon::base
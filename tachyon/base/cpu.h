@@ -0,0 +1,94 @@
+// Copyright 2012 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TACHYON_BASE_CPU_H_
+#define TACHYON_BASE_CPU_H_
+
+#include <string>
+
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// Query information about the processor.
+class TACHYON_EXPORT CPU final {
+ public:
+  CPU();
+  CPU(CPU&&);
+  CPU(const CPU&) = delete;
+
+  // Get a preallocated instance of CPU.
+  // This can be used in very early application startup. The instance of CPU is
+  // created without branding, see CPU(bool requires_branding) for details and
+  // implications.
+  static const CPU& GetInstanceNoAllocation();
+
+  // Accessors for CPU information.
+  const std::string& vendor_name() const { return cpu_vendor_; }
+  int signature() const { return signature_; }
+  int stepping() const { return stepping_; }
+  int model() const { return model_; }
+  int family() const { return family_; }
+  int type() const { return type_; }
+  int extended_model() const { return ext_model_; }
+  int extended_family() const { return ext_family_; }
+  bool has_mmx() const { return has_mmx_; }
+  bool has_sse() const { return has_sse_; }
+  bool has_sse2() const { return has_sse2_; }
+  bool has_sse3() const { return has_sse3_; }
+  bool has_ssse3() const { return has_ssse3_; }
+  bool has_sse41() const { return has_sse41_; }
+  bool has_sse42() const { return has_sse42_; }
+  bool has_popcnt() const { return has_popcnt_; }
+  bool has_avx() const { return has_avx_; }
+  bool has_fma3() const { return has_fma3_; }
+  bool has_avx2() const { return has_avx2_; }
+  // BMI2 provides MULX, which multiplies without touching the flags.
+  bool has_bmi2() const { return has_bmi2_; }
+  // ADX provides ADCX and ADOX, which propagate the carry through CF and OF
+  // respectively, so that two carry chains can be interleaved.
+  bool has_adx() const { return has_adx_; }
+  bool has_avx512f() const { return has_avx512f_; }
+  bool has_avx512dq() const { return has_avx512dq_; }
+  bool has_avx512vl() const { return has_avx512vl_; }
+  // AVX512_IFMA provides VPMADD52LUQ and VPMADD52HUQ.
+  bool has_avx512ifma() const { return has_avx512ifma_; }
+  const std::string& cpu_brand() const { return cpu_brand_; }
+
+ private:
+  // Query the processor for CPUID information.
+  void Initialize(bool requires_branding);
+  explicit CPU(bool requires_branding);
+
+  int signature_ = 0;  // raw form of type, family, model, and stepping
+  int type_ = 0;       // process type
+  int family_ = 0;     // family of the processor
+  int model_ = 0;      // model of processor
+  int stepping_ = 0;   // processor revision number
+  int ext_model_ = 0;
+  int ext_family_ = 0;
+  bool has_mmx_ = false;
+  bool has_sse_ = false;
+  bool has_sse2_ = false;
+  bool has_sse3_ = false;
+  bool has_ssse3_ = false;
+  bool has_sse41_ = false;
+  bool has_sse42_ = false;
+  bool has_popcnt_ = false;
+  bool has_avx_ = false;
+  bool has_fma3_ = false;
+  bool has_avx2_ = false;
+  bool has_bmi2_ = false;
+  bool has_adx_ = false;
+  bool has_avx512f_ = false;
+  bool has_avx512dq_ = false;
+  bool has_avx512vl_ = false;
+  bool has_avx512ifma_ = false;
+  std::string cpu_vendor_ = "unknown";
+  std::string cpu_brand_;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_CPU_H_
@@ -0,0 +1,101 @@
+#include "tachyon/base/cpu_features.h"
+
+#include "tachyon/base/environment.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+namespace {
+
+constexpr CpuFeature kAllCpuFeatures[] = {
+    CpuFeature::kBmi2,    CpuFeature::kAdx,        CpuFeature::kAvx2,
+    CpuFeature::kAvx512f, CpuFeature::kAvx512Ifma,
+};
+
+bool IsSupported(const CPU& cpu, CpuFeature feature) {
+  switch (feature) {
+    case CpuFeature::kBmi2:
+      return cpu.has_bmi2();
+    case CpuFeature::kAdx:
+      return cpu.has_adx();
+    case CpuFeature::kAvx2:
+      return cpu.has_avx2();
+    case CpuFeature::kAvx512f:
+      return cpu.has_avx512f();
+    case CpuFeature::kAvx512Ifma:
+      return cpu.has_avx512ifma();
+  }
+  NOTREACHED();
+  return false;
+}
+
+}  // namespace
+
+std::string_view CpuFeatureToString(CpuFeature feature) {
+  switch (feature) {
+    case CpuFeature::kBmi2:
+      return "bmi2";
+    case CpuFeature::kAdx:
+      return "adx";
+    case CpuFeature::kAvx2:
+      return "avx2";
+    case CpuFeature::kAvx512f:
+      return "avx512f";
+    case CpuFeature::kAvx512Ifma:
+      return "avx512ifma";
+  }
+  NOTREACHED();
+  return "";
+}
+
+CpuFeatures::CpuFeatures(const CPU& cpu, std::string_view disabled) {
+  for (CpuFeature feature : kAllCpuFeatures) {
+    if (IsSupported(cpu, feature)) {
+      features_ |= static_cast<uint32_t>(feature);
+    }
+  }
+  while (!disabled.empty()) {
+    size_t pos = disabled.find(',');
+    std::string_view name = disabled.substr(0, pos);
+    disabled.remove_prefix(pos == std::string_view::npos ? disabled.size()
+                                                         : pos + 1);
+    while (!name.empty() && name.front() == ' ') name.remove_prefix(1);
+    while (!name.empty() && name.back() == ' ') name.remove_suffix(1);
+    if (name.empty()) continue;
+    if (name == "all") {
+      features_ = 0;
+      continue;
+    }
+    bool found = false;
+    for (CpuFeature feature : kAllCpuFeatures) {
+      if (name == CpuFeatureToString(feature)) {
+        features_ &= ~static_cast<uint32_t>(feature);
+        found = true;
+        break;
+      }
+    }
+    LOG_IF(WARNING, !found) << "Unknown cpu feature: " << name;
+  }
+}
+
+// static
+const CpuFeatures& CpuFeatures::Get() {
+  static const CpuFeatures features = []() {
+    std::string_view disabled;
+    Environment::Get(kDisableEnvVar, &disabled);
+    return CpuFeatures(CPU::GetInstanceNoAllocation(), disabled);
+  }();
+  return features;
+}
+
+std::string CpuFeatures::ToString() const {
+  std::string ret;
+  for (CpuFeature feature : kAllCpuFeatures) {
+    if (!Has(feature)) continue;
+    if (!ret.empty()) ret += ",";
+    ret += CpuFeatureToString(feature);
+  }
+  return ret;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,62 @@
+#ifndef TACHYON_BASE_CPU_FEATURES_H_
+#define TACHYON_BASE_CPU_FEATURES_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+
+#include "tachyon/base/cpu.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// The CPU features by which the kernels are chosen at runtime.
+enum class CpuFeature : uint32_t {
+  kBmi2 = 1 << 0,
+  kAdx = 1 << 1,
+  kAvx2 = 1 << 2,
+  kAvx512f = 1 << 3,
+  kAvx512Ifma = 1 << 4,
+};
+
+TACHYON_EXPORT std::string_view CpuFeatureToString(CpuFeature feature);
+
+// |CpuFeatures| is the set of |CpuFeature|s that the kernels are allowed to
+// use. The kernels check it instead of |CPU| so that a single binary can be
+// shipped to hosts with different CPUs and the kernels can still be pinned to
+// the fallbacks, e.g., to compare the results or to rule out a SIMD kernel,
+// by setting the environment variable |kDisableEnvVar|.
+class TACHYON_EXPORT CpuFeatures {
+ public:
+  // A comma-separated list of the names returned by |CpuFeatureToString()|,
+  // e.g., "avx512f,avx512ifma", or "all".
+  constexpr static std::string_view kDisableEnvVar =
+      "TACHYON_DISABLE_CPU_FEATURES";
+
+  // Creates the features supported by |cpu| except the ones in |disabled|.
+  // See |kDisableEnvVar| for the format of |disabled|.
+  CpuFeatures(const CPU& cpu, std::string_view disabled);
+
+  // Returns the features detected once from the running CPU and
+  // |kDisableEnvVar|.
+  static const CpuFeatures& Get();
+
+  bool Has(CpuFeature feature) const {
+    return (features_ & static_cast<uint32_t>(feature)) != 0;
+  }
+
+  std::string ToString() const;
+
+ private:
+  uint32_t features_ = 0;
+};
+
+// Syntactic sugar for |CpuFeatures::Get().Has(feature)|.
+inline bool HasCpuFeature(CpuFeature feature) {
+  return CpuFeatures::Get().Has(feature);
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_CPU_FEATURES_H_
@@ -0,0 +1,37 @@
+#include "tachyon/base/cpu_features.h"
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(CpuFeaturesTest, Detect) {
+  const CPU& cpu = CPU::GetInstanceNoAllocation();
+  CpuFeatures features(cpu, "");
+  EXPECT_EQ(features.Has(CpuFeature::kBmi2), cpu.has_bmi2());
+  EXPECT_EQ(features.Has(CpuFeature::kAdx), cpu.has_adx());
+  EXPECT_EQ(features.Has(CpuFeature::kAvx2), cpu.has_avx2());
+  EXPECT_EQ(features.Has(CpuFeature::kAvx512f), cpu.has_avx512f());
+  EXPECT_EQ(features.Has(CpuFeature::kAvx512Ifma), cpu.has_avx512ifma());
+}
+
+TEST(CpuFeaturesTest, Disable) {
+  const CPU& cpu = CPU::GetInstanceNoAllocation();
+  CpuFeatures features(cpu, "avx2, adx,unknown");
+  EXPECT_EQ(features.Has(CpuFeature::kBmi2), cpu.has_bmi2());
+  EXPECT_FALSE(features.Has(CpuFeature::kAdx));
+  EXPECT_FALSE(features.Has(CpuFeature::kAvx2));
+  EXPECT_EQ(features.Has(CpuFeature::kAvx512f), cpu.has_avx512f());
+
+  CpuFeatures none(cpu, "all");
+  EXPECT_EQ(none.ToString(), "");
+}
+
+TEST(CpuFeaturesTest, ToString) {
+  const CPU& cpu = CPU::GetInstanceNoAllocation();
+  CpuFeatures features(cpu, "");
+  std::string str = features.ToString();
+  EXPECT_EQ(str.find("avx2") != std::string::npos, cpu.has_avx2());
+  EXPECT_EQ(str.find("adx") != std::string::npos, cpu.has_adx());
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,68 @@
+// Copyright 2012 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/cpu.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/build/build_config.h"
+
+namespace tachyon::base {
+
+// Tests whether we can run extended instructions represented by the CPU
+// information. This test actually executes some extended instructions (such as
+// MMX, SSE, etc.) supported by the CPU and sees we can run them without
+// "undefined instruction" exceptions. That is, this test succeeds when this
+// test finishes without a crash.
+TEST(CPU, RunExtendedInstructions) {
+#if defined(ARCH_CPU_X86_FAMILY)
+  // Retrieve the CPU information.
+  CPU cpu;
+
+  if (cpu.has_mmx()) {
+    // Execute an MMX instruction.
+    __asm__ __volatile__("emms\n" : : : "mm0");
+  }
+
+  if (cpu.has_sse()) {
+    // Execute an SSE instruction.
+    __asm__ __volatile__("xorps %%xmm0, %%xmm0\n" : : : "xmm0");
+  }
+
+  if (cpu.has_sse2()) {
+    // Execute an SSE 2 instruction.
+    __asm__ __volatile__("psrldq $0, %%xmm0\n" : : : "xmm0");
+  }
+
+  if (cpu.has_avx()) {
+    // Execute an AVX instruction.
+    __asm__ __volatile__("vzeroupper\n" : : : "xmm0");
+  }
+
+  if (cpu.has_bmi2()) {
+    // Execute a BMI2 instruction.
+    __asm__ __volatile__("xorq %%rdx, %%rdx\nmulxq %%rdx, %%rax, %%rcx\n"
+                         :
+                         :
+                         : "rax", "rcx", "rdx");
+  }
+
+  if (cpu.has_adx()) {
+    // Execute an ADX instruction.
+    __asm__ __volatile__("xorq %%rax, %%rax\nadcxq %%rax, %%rax\n"
+                         :
+                         :
+                         : "rax", "cc");
+  }
+#endif  // defined(ARCH_CPU_X86_FAMILY)
+}
+
+TEST(CPU, GetInstanceNoAllocation) {
+  const CPU& cpu = CPU::GetInstanceNoAllocation();
+  EXPECT_EQ(&cpu, &CPU::GetInstanceNoAllocation());
+  // The instance is created without branding.
+  EXPECT_TRUE(cpu.cpu_brand().empty());
+}
+
+}  // namespace tachyon::base
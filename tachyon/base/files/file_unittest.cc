@@ -9,7 +9,7 @@
 #include <utility>
 
 #include "tachyon/base/files/file_util.h"
-// #include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/base/time/time.h"
@@ -0,0 +1,137 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/safe_conversions.h"
+
+namespace tachyon::base {
+
+// static
+size_t MemoryMappedFile::GetVMAllocationGranularity() {
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+bool MemoryMappedFile::MapFileRegionToMemory(
+    const MemoryMappedFile::Region& region, Access access) {
+  off_t map_start = 0;
+  size_t map_size = 0;
+  int32_t data_offset = 0;
+
+  if (region == MemoryMappedFile::Region::kWholeFile) {
+    int64_t file_len = file_.GetLength();
+    if (file_len < 0) {
+      DPLOG(ERROR) << "fstat " << file_.GetPlatformFile();
+      return false;
+    }
+    if (!IsValueInRangeForNumericType<size_t>(file_len)) return false;
+    map_size = static_cast<size_t>(file_len);
+    length_ = map_size;
+  } else {
+    // The region can be arbitrarily aligned. mmap, instead, requires both the
+    // start and size to be page-aligned. Hence, we map here the page-aligned
+    // outer region [|aligned_start|, |aligned_start| + |size|] which contains
+    // |region| and then add up the |data_offset| displacement.
+    int64_t aligned_start = 0;
+    size_t aligned_size = 0;
+    CalculateVMAlignedBoundaries(region.offset, region.size, &aligned_start,
+                                 &aligned_size, &data_offset);
+
+    // Ensure that the casts in the mmap call below are sane.
+    if (aligned_start < 0 ||
+        !IsValueInRangeForNumericType<off_t>(aligned_start)) {
+      DLOG(ERROR) << "Region bounds are not valid for mmap";
+      return false;
+    }
+
+    map_start = static_cast<off_t>(aligned_start);
+    map_size = aligned_size;
+    length_ = region.size;
+  }
+
+  int flags = 0;
+  switch (access) {
+    case READ_ONLY:
+      flags |= PROT_READ;
+      break;
+
+    case READ_WRITE:
+      flags |= PROT_READ | PROT_WRITE;
+      break;
+
+    case READ_WRITE_EXTEND:
+      flags |= PROT_READ | PROT_WRITE;
+
+      const int64_t new_file_len = region.offset + region.size;
+
+      // POSIX won't auto-extend the file when it is written so it must first
+      // be explicitly extended to the maximum size. Zeros will fill the new
+      // space. It is assumed that the existing file is fully realized as
+      // otherwise the entire file would have to be read and possibly written.
+      const int64_t original_file_len = file_.GetLength();
+      if (original_file_len < 0) {
+        DPLOG(ERROR) << "fstat " << file_.GetPlatformFile();
+        return false;
+      }
+
+      // Increase the actual length of the file, if necessary. This can fail if
+      // the disk is full and the OS doesn't support sparse files.
+      if (!file_.SetLength(std::max(original_file_len, new_file_len))) {
+        DPLOG(ERROR) << "ftruncate " << file_.GetPlatformFile();
+        return false;
+      }
+      break;
+  }
+
+  if (map_size == 0) {
+    // mmap() fails with EINVAL on an empty region.
+    DLOG(ERROR) << "Can't map an empty region";
+    return false;
+  }
+
+  void* data = mmap(nullptr, map_size, flags, MAP_SHARED,
+                    file_.GetPlatformFile(), map_start);
+  if (data == MAP_FAILED) {
+    DPLOG(ERROR) << "mmap " << file_.GetPlatformFile();
+    return false;
+  }
+
+  access_ = access;
+  data_ = static_cast<uint8_t*>(data) + data_offset;
+  data_offset_ = data_offset;
+  return true;
+}
+
+bool MemoryMappedFile::Flush() {
+  if (!IsValid() || access_ == READ_ONLY) return false;
+  if (msync(data_ - data_offset_, length_ + data_offset_, MS_SYNC) != 0) {
+    DPLOG(ERROR) << "msync " << file_.GetPlatformFile();
+    return false;
+  }
+  return true;
+}
+
+void MemoryMappedFile::CloseHandles() {
+  if (data_ != nullptr) {
+    munmap(data_ - data_offset_, length_ + data_offset_);
+  }
+  file_.Close();
+
+  access_ = READ_ONLY;
+  data_ = nullptr;
+  length_ = 0;
+  data_offset_ = 0;
+}
+
+}  // namespace tachyon::base
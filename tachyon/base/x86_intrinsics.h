@@ -0,0 +1,37 @@
+#ifndef TACHYON_BASE_X86_INTRINSICS_H_
+#define TACHYON_BASE_X86_INTRINSICS_H_
+
+// Include this instead of <immintrin.h>.
+//
+// NOTE: GCC 12 raises false -Wuninitialized warnings in the AVX-512
+// intrinsics. See https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105593.
+// The warnings are reported at the locations in the intrinsic headers, so
+// they have to be suppressed where the headers are included for the first
+// time.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#else
+#include <immintrin.h>
+#endif
+
+// Functions marked with these are compiled for the given instruction set
+// regardless of the compiler flags, so callers must check the cpu features at
+// runtime before calling them. See tachyon/base/cpu_features.h.
+#define TACHYON_AVX2_TARGET __attribute__((target("avx2")))
+#define TACHYON_AVX2_INLINE \
+  inline __attribute__((always_inline, target("avx2")))
+
+#define TACHYON_AVX512F_TARGET __attribute__((target("avx512f")))
+#define TACHYON_AVX512F_INLINE \
+  inline __attribute__((always_inline, target("avx512f")))
+
+#define TACHYON_AVX512_IFMA_TARGET \
+  __attribute__((target("avx512f,avx512ifma")))
+#define TACHYON_AVX512_IFMA_INLINE \
+  inline __attribute__((always_inline, target("avx512f,avx512ifma")))
+
+#endif  // TACHYON_BASE_X86_INTRINSICS_H_
@@ -7,12 +7,20 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_H_
 #define TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_H_
 
+#include <stdint.h>
+#include <string.h>
+
 #include <algorithm>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
@@ -88,11 +96,128 @@ class KZG {
                                &g1_powers_of_tau_lagrange_);
   }
 
-  // Return false if |n| >= |N()|.
+  // Return false if |n| >= |N()| or |n| is not a power of two. The lagrange
+  // bases of the smaller domain are not a prefix of the current ones, so they
+  // are recomputed from the powers of tau. This is an IFFT over the group,
+  // which costs O(n log n) scalar multiplications. Use |LoadSRSFile()| with a
+  // smaller size to avoid it.
   [[nodiscard]] bool Downsize(size_t n) {
-    if (n >= N()) return false;
+    if (n >= N() || !base::bits::IsPowerOfTwo(n)) return false;
     g1_powers_of_tau_.resize(n);
-    g1_powers_of_tau_lagrange_.resize(n);
+    return ComputeLagrangeBasis(g1_powers_of_tau_,
+                                &g1_powers_of_tau_lagrange_);
+  }
+
+  // Writes the SRS to |path| so that |LoadSRSFile()| can map it later. |N()|
+  // must be a power of two. The file is laid out as below, where every array
+  // is affine points in native layout, starting at a multiple of
+  // |kSRSFileAlignment|. The lagrange bases of every smaller power of two are
+  // stored too, so that a downsized SRS is loaded without any computation.
+  // Computing them costs O(N log N) scalar multiplications, but only once
+  // here.
+  //
+  // | array                              | count |
+  // |------------------------------------|-------|
+  // | |SRSFileHeader|                    | 1     |
+  // | |g1_powers_of_tau_|                | N     |
+  // | |g1_powers_of_tau_lagrange_|       | N     |
+  // | lagrange bases of the size N / 2   | N / 2 |
+  // | ...                                | ...   |
+  // | lagrange bases of the size 1       | 1     |
+  [[nodiscard]] bool WriteSRSFile(const base::FilePath& path) const {
+    if (!base::bits::IsPowerOfTwo(N())) {
+      LOG(ERROR) << "SRS file requires a power of two size";
+      return false;
+    }
+    SRSFileHeader header = SRSFileHeader::Create(N());
+
+    base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                              base::File::FLAG_READ | base::File::FLAG_WRITE);
+    if (!file.IsValid()) {
+      LOG(ERROR) << "Failed to create " << path.value();
+      return false;
+    }
+    base::MemoryMappedFile mapped;
+    if (!mapped.Initialize(std::move(file), {0, header.GetFileSize()},
+                           base::MemoryMappedFile::READ_WRITE_EXTEND)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    uint8_t* data = mapped.data();
+    uint8_t* powers_of_tau = data + header.GetPowersOffset();
+    memcpy(powers_of_tau, g1_powers_of_tau_.data(), N() * sizeof(G1PointTy));
+    size_t log_n = header.GetLogN();
+    for (size_t k = 0; k <= log_n; ++k) {
+      size_t size = (size_t{1} << k) * sizeof(G1PointTy);
+      uint8_t* lagrange = data + header.GetLagrangeOffset(k);
+      if (k == log_n) {
+        memcpy(lagrange, g1_powers_of_tau_lagrange_.data(), size);
+      } else {
+        std::vector<G1PointTy> g1_powers_of_tau_lagrange;
+        absl::Span<const G1PointTy> g1_powers_of_tau =
+            absl::MakeConstSpan(g1_powers_of_tau_).subspan(0, size_t{1} << k);
+        if (!ComputeLagrangeBasis(g1_powers_of_tau,
+                                  &g1_powers_of_tau_lagrange)) {
+          return false;
+        }
+        memcpy(lagrange, g1_powers_of_tau_lagrange.data(), size);
+      }
+      header.powers_checksums[k] = ComputeChecksum(powers_of_tau, size);
+      header.lagrange_checksums[k] = ComputeChecksum(lagrange, size);
+    }
+    memcpy(data, &header, sizeof(header));
+    return mapped.Flush();
+  }
+
+  // Loads the SRS written by |WriteSRSFile()| from |path|, downsized to |n|
+  // if |n| is not 0. |n| must be a power of two less than or equal to the
+  // size of the file. The file is memory-mapped and the points are copied in
+  // bulk. Only the first |n| powers and the lagrange bases of the size |n| are
+  // read, and they are verified against their checksums.
+  [[nodiscard]] bool LoadSRSFile(const base::FilePath& path, size_t n = 0) {
+    base::MemoryMappedFile mapped;
+    if (!mapped.Initialize(path)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    if (mapped.length() < sizeof(SRSFileHeader)) {
+      LOG(ERROR) << "SRS file is too short";
+      return false;
+    }
+    SRSFileHeader header;
+    memcpy(&header, mapped.data(), sizeof(header));
+    if (!header.IsValid()) {
+      LOG(ERROR) << "Invalid or unsupported SRS file";
+      return false;
+    }
+    if (mapped.length() != header.GetFileSize()) {
+      LOG(ERROR) << "SRS file has a wrong size";
+      return false;
+    }
+    size_t size = static_cast<size_t>(header.n);
+    if (n == 0) n = size;
+    if (n > size || n > kMaxDegree + 1 || !base::bits::IsPowerOfTwo(n)) {
+      LOG(ERROR) << "Can't load an SRS of size " << n << " from " << size;
+      return false;
+    }
+
+    const uint8_t* data = mapped.data();
+    const uint8_t* powers_of_tau = data + header.GetPowersOffset();
+    size_t k = base::bits::Log2Floor(n);
+    const uint8_t* lagrange = data + header.GetLagrangeOffset(k);
+    if (ComputeChecksum(powers_of_tau, n * sizeof(G1PointTy)) !=
+            header.powers_checksums[k] ||
+        ComputeChecksum(lagrange, n * sizeof(G1PointTy)) !=
+            header.lagrange_checksums[k]) {
+      LOG(ERROR) << "SRS file has a wrong checksum";
+      return false;
+    }
+    const G1PointTy* powers_of_tau_points =
+        reinterpret_cast<const G1PointTy*>(powers_of_tau);
+    const G1PointTy* lagrange_points =
+        reinterpret_cast<const G1PointTy*>(lagrange);
+    g1_powers_of_tau_.assign(powers_of_tau_points, powers_of_tau_points + n);
+    g1_powers_of_tau_lagrange_.assign(lagrange_points, lagrange_points + n);
     return true;
   }
 
@@ -107,7 +232,179 @@ class KZG {
     return DoMSM(g1_powers_of_tau_lagrange_, v, out);
   }
 
+  // Commits to each of |vs| against the same bases in a single pass. See
+  // |math::Pippenger::RunBatch()|.
+  template <typename BaseContainersTy>
+  [[nodiscard]] bool CommitBatch(const BaseContainersTy& vs,
+                                 std::vector<Commitment>* outs) const {
+    return DoMSMBatch(g1_powers_of_tau_, vs, outs);
+  }
+
+  template <typename BaseContainersTy>
+  [[nodiscard]] bool CommitLagrangeBatch(const BaseContainersTy& vs,
+                                         std::vector<Commitment>* outs) const {
+    return DoMSMBatch(g1_powers_of_tau_lagrange_, vs, outs);
+  }
+
  private:
+  // The alignment of every array in the file written by |WriteSRSFile()|.
+  constexpr static size_t kSRSFileAlignment = 64;
+  // The maximum number of powers of two that an SRS file can have.
+  constexpr static size_t kMaxSRSFileLogN = 64;
+  // The minimum number of words to compute a checksum in parallel.
+  constexpr static size_t kMinParallelChecksumSize = size_t{1} << 16;
+
+  struct SRSFileHeader {
+    constexpr static char kMagic[8] = "TCHYSRS";
+    constexpr static uint32_t kVersion = 1;
+
+    char magic[8];
+    uint32_t version;
+    // The size of an affine point in bytes.
+    uint32_t point_size;
+    // The checksum of the generator, which identifies the curve.
+    uint64_t curve_id;
+    uint64_t n;
+    // |powers_checksums[k]| is the checksum of the first 2ᵏ powers of tau,
+    // and |lagrange_checksums[k]| is the checksum of the lagrange bases of
+    // the size 2ᵏ.
+    uint64_t powers_checksums[kMaxSRSFileLogN];
+    uint64_t lagrange_checksums[kMaxSRSFileLogN];
+
+    static SRSFileHeader Create(size_t n) {
+      SRSFileHeader header = {};
+      memcpy(header.magic, kMagic, sizeof(kMagic));
+      header.version = kVersion;
+      header.point_size = sizeof(G1PointTy);
+      header.curve_id = GetCurveId();
+      header.n = n;
+      return header;
+    }
+
+    bool IsValid() const {
+      return memcmp(magic, kMagic, sizeof(kMagic)) == 0 &&
+             version == kVersion && point_size == sizeof(G1PointTy) &&
+             curve_id == GetCurveId() && n != 0 &&
+             base::bits::IsPowerOfTwo(n);
+    }
+
+    size_t GetLogN() const { return base::bits::Log2Floor(n); }
+
+    size_t GetPowersOffset() const {
+      return base::bits::AlignUp(sizeof(SRSFileHeader), kSRSFileAlignment);
+    }
+
+    // Returns the offset of the lagrange bases of the size 2ᵏ.
+    size_t GetLagrangeOffset(size_t k) const {
+      size_t offset = GetPowersOffset() + GetArraySize(GetLogN());
+      for (size_t i = GetLogN(); i > k; --i) {
+        offset += GetArraySize(i);
+      }
+      return offset;
+    }
+
+    size_t GetFileSize() const {
+      return GetLagrangeOffset(0) + GetArraySize(0);
+    }
+
+    static size_t GetArraySize(size_t k) {
+      return base::bits::AlignUp((size_t{1} << k) * sizeof(G1PointTy),
+                                 kSRSFileAlignment);
+    }
+  };
+  static_assert(std::is_trivially_copyable_v<G1PointTy>,
+                "The SRS file requires trivially copyable points");
+  static_assert(sizeof(G1PointTy) % sizeof(uint64_t) == 0,
+                "The SRS file requires points of a multiple of 8 bytes");
+
+  static uint64_t GetCurveId() {
+    using BaseField = typename G1PointTy::BaseField;
+
+    G1PointTy g1 = G1PointTy::Generator();
+    uint64_t words[2 * sizeof(BaseField) / sizeof(uint64_t)];
+    memcpy(words, &g1.x(), sizeof(BaseField));
+    memcpy(reinterpret_cast<uint8_t*>(words) + sizeof(BaseField), &g1.y(),
+           sizeof(BaseField));
+    return ComputeChecksum(reinterpret_cast<const uint8_t*>(words),
+                           sizeof(words));
+  }
+
+  // Returns an order dependent checksum of |size| bytes at |data|, which must
+  // be a multiple of 8. Each word is mixed with its index, so that the words
+  // can be summed up in parallel.
+  static uint64_t ComputeChecksum(const uint8_t* data, size_t size) {
+    DCHECK_EQ(size % sizeof(uint64_t), size_t{0});
+    absl::Span<const uint64_t> words(reinterpret_cast<const uint64_t*>(data),
+                                     size / sizeof(uint64_t));
+    size_t chunk_size =
+        base::GetNumElementsPerThread(words, kMinParallelChecksumSize);
+    if (chunk_size == 0) return 0;
+    size_t num_chunks = (words.size() + chunk_size - 1) / chunk_size;
+    std::vector<uint64_t> partial_checksums(num_chunks);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      size_t end = std::min((i + 1) * chunk_size, words.size());
+      uint64_t sum = 0;
+      for (size_t j = i * chunk_size; j < end; ++j) {
+        // See https://prng.di.unimi.it/splitmix64.c.
+        uint64_t z = words[j] + (j + 1) * 0x9e3779b97f4a7c15;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        sum += z ^ (z >> 31);
+      }
+      partial_checksums[i] = sum;
+    }
+    uint64_t checksum = 0;
+    for (uint64_t partial_checksum : partial_checksums) {
+      checksum += partial_checksum;
+    }
+    return checksum;
+  }
+
+  // Computes [L₀(𝜏)g₁, ..., Lₙ₋₁(𝜏)g₁] of the domain of size n from
+  // [𝜏⁰g₁, ..., 𝜏ⁿ⁻¹g₁], which is the IFFT of the latter over the group.
+  [[nodiscard]] static bool ComputeLagrangeBasis(
+      absl::Span<const G1PointTy> g1_powers_of_tau,
+      std::vector<G1PointTy>* g1_powers_of_tau_lagrange) {
+    using G1JacobianPointTy = typename G1PointTy::JacobianPointTy;
+    using DomainTy = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
+
+    size_t n = g1_powers_of_tau.size();
+    if (!base::bits::IsPowerOfTwo(n)) return false;
+    std::unique_ptr<DomainTy> domain = DomainTy::Create(n);
+    uint32_t log_n = base::bits::Log2Ceiling(n);
+
+    // Bit-reverse the inputs so that the outputs are in order.
+    std::vector<G1JacobianPointTy> points(n);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      size_t ridx = log_n == 0 ? i
+                                : base::bits::BitRev(i) >>
+                                      (sizeof(size_t) * 8 - log_n);
+      points[ridx] = g1_powers_of_tau[i].ToJacobian();
+    }
+
+    // [ω⁰, ω⁻¹, ..., ω⁻⁽ⁿ/²⁻¹⁾]
+    std::vector<Field> roots =
+        Field::GetSuccessivePowers(n / 2, domain->group_gen_inv());
+    for (size_t len = 2; len <= n; len <<= 1) {
+      size_t half = len / 2;
+      size_t stride = n / len;
+      OPENMP_PARALLEL_FOR(size_t k = 0; k < n / 2; ++k) {
+        size_t j = k % half;
+        size_t lo = (k / half) * len + j;
+        G1JacobianPointTy hi = points[lo + half];
+        if (j != 0) hi *= roots[j * stride];
+        points[lo + half] = points[lo] - hi;
+        points[lo] += hi;
+      }
+    }
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      points[i] *= domain->size_inv();
+    }
+
+    g1_powers_of_tau_lagrange->resize(n);
+    return math::ConvertPoints(points, g1_powers_of_tau_lagrange);
+  }
+
   template <typename BaseContainerTy, typename ScalarContainerTy>
   static bool DoMSM(const BaseContainerTy& bases,
                     const ScalarContainerTy& scalars, Commitment* out) {
@@ -126,6 +423,42 @@ class KZG {
     }
   }
 
+  template <typename BaseContainerTy, typename ScalarContainersTy>
+  static bool DoMSMBatch(const BaseContainerTy& bases,
+                         const ScalarContainersTy& scalars_vec,
+                         std::vector<Commitment>* outs) {
+    using Bucket = typename math::Pippenger<G1PointTy>::Bucket;
+
+    size_t size = 0;
+    std::vector<absl::Span<const Field>> scalars_spans;
+    scalars_spans.reserve(std::size(scalars_vec));
+    for (const auto& scalars : scalars_vec) {
+      absl::Span<const Field> scalars_span = absl::MakeConstSpan(scalars);
+      if (scalars_span.size() > bases.size()) {
+        LOG(ERROR) << "Too many scalars: " << scalars_span.size() << " > "
+                   << bases.size();
+        return false;
+      }
+      size = std::max(size, scalars_span.size());
+      scalars_spans.push_back(scalars_span);
+    }
+
+    math::VariableBaseMSM<G1PointTy> msm;
+    absl::Span<const G1PointTy> bases_span =
+        absl::Span<const G1PointTy>(bases.data(), size);
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      return msm.RunBatch(bases_span, absl::MakeConstSpan(scalars_spans), outs);
+    } else {
+      std::vector<Bucket> results;
+      if (!msm.RunBatch(bases_span, absl::MakeConstSpan(scalars_spans),
+                        &results)) {
+        return false;
+      }
+      outs->resize(results.size());
+      return math::ConvertPoints(results, outs);
+    }
+  }
+
   std::vector<G1PointTy> g1_powers_of_tau_;
   std::vector<G1PointTy> g1_powers_of_tau_lagrange_;
 };
@@ -8,6 +8,7 @@
 #define TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_FAMILY_H_
 
 #include <utility>
+#include <vector>
 
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 
@@ -44,6 +45,18 @@ class KZGFamily {
     return kzg_.CommitLagrange(poly, commitment);
   }
 
+  template <typename ContainersTy>
+  [[nodiscard]] bool DoCommitBatch(const ContainersTy& polys,
+                                   std::vector<Commitment>* commitments) const {
+    return kzg_.CommitBatch(polys, commitments);
+  }
+
+  template <typename ContainersTy>
+  [[nodiscard]] bool DoCommitLagrangeBatch(
+      const ContainersTy& polys, std::vector<Commitment>* commitments) const {
+    return kzg_.CommitLagrangeBatch(polys, commitments);
+  }
+
  protected:
   [[nodiscard]] virtual bool DoUnsafeSetupWithTau(size_t size,
                                                   const F& tau) = 0;
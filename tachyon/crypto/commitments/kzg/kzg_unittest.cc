@@ -1,8 +1,13 @@
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 
+#include <algorithm>
+
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 
@@ -55,12 +60,113 @@ TEST_F(KZGTest, CommitLagrange) {
   EXPECT_EQ(commit, commit_lagrange);
 }
 
-TEST_F(KZGTest, Downsize) {
+TEST_F(KZGTest, CommitBatch) {
+  using Domain = math::UnivariateEvaluationDomain<math::bn254::Fr, kMaxDegree>;
+  using Poly = math::UnivariateDensePolynomial<math::bn254::Fr, kMaxDegree>;
+  using Evals = math::UnivariateEvaluations<math::bn254::Fr, kMaxDegree>;
+
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  std::vector<Poly> polys = {Poly::Random(N - 1), Poly::Random(N / 2 - 1),
+                             Poly::Random(N - 1)};
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  std::vector<std::vector<math::bn254::Fr>> coeffs_vec;
+  std::vector<std::vector<math::bn254::Fr>> evals_vec;
+  std::vector<math::bn254::G1AffinePoint> expected;
+  for (const Poly& poly : polys) {
+    coeffs_vec.push_back(poly.coefficients().coefficients());
+    Evals evals = domain->FFT(poly);
+    evals_vec.push_back(evals.evaluations());
+    math::bn254::G1AffinePoint commit;
+    ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &commit));
+    expected.push_back(commit);
+  }
+
+  std::vector<math::bn254::G1AffinePoint> commits;
+  ASSERT_TRUE(pcs.CommitBatch(coeffs_vec, &commits));
+  EXPECT_EQ(commits, expected);
+  ASSERT_TRUE(pcs.CommitLagrangeBatch(evals_vec, &commits));
+  EXPECT_EQ(commits, expected);
+}
+
+TEST_F(KZGTest, CommitBatchWithTooManyScalars) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  std::vector<std::vector<math::bn254::Fr>> coeffs_vec = {
+      base::CreateVector(N, []() { return math::bn254::Fr::Random(); }),
+      base::CreateVector(N + 1, []() { return math::bn254::Fr::Random(); })};
+
+  math::bn254::G1AffinePoint commit;
+  EXPECT_FALSE(pcs.Commit(coeffs_vec[1], &commit));
+  std::vector<math::bn254::G1AffinePoint> commits;
+  EXPECT_FALSE(pcs.CommitBatch(coeffs_vec, &commits));
+  EXPECT_FALSE(pcs.CommitLagrangeBatch(coeffs_vec, &commits));
+}
+
+TEST_F(KZGTest, Downsize) {
+  math::bn254::Fr tau = math::bn254::Fr::Random();
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N, tau));
   ASSERT_FALSE(pcs.Downsize(N));
+  ASSERT_FALSE(pcs.Downsize(N / 2 + 1));
   ASSERT_TRUE(pcs.Downsize(N / 2));
   EXPECT_EQ(pcs.N(), N / 2);
+
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N / 2, tau));
+  EXPECT_EQ(pcs.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+}
+
+TEST_F(KZGTest, SRSFile) {
+  math::bn254::Fr tau = math::bn254::Fr::Random();
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N, tau));
+
+  base::ScopedTempDir dir;
+  ASSERT_TRUE(dir.CreateUniqueTempDir());
+  base::FilePath path = dir.GetPath().Append("srs");
+  ASSERT_TRUE(expected.WriteSRSFile(path));
+
+  PCS pcs;
+  ASSERT_TRUE(pcs.LoadSRSFile(path));
+  EXPECT_EQ(pcs.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+
+  ASSERT_FALSE(pcs.LoadSRSFile(path, N * 2));
+  ASSERT_FALSE(pcs.LoadSRSFile(path, N / 2 + 1));
+  for (size_t n = N / 2; n >= 1; n /= 2) {
+    SCOPED_TRACE(absl::Substitute("n: $0", n));
+    ASSERT_TRUE(pcs.LoadSRSFile(path, n));
+    PCS downsized;
+    ASSERT_TRUE(downsized.UnsafeSetup(n, tau));
+    EXPECT_EQ(pcs.g1_powers_of_tau(), downsized.g1_powers_of_tau());
+    EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+              downsized.g1_powers_of_tau_lagrange());
+  }
+
+  // A corrupted file is rejected, even when it is downsized.
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ |
+                            base::File::FLAG_WRITE);
+  ASSERT_TRUE(file.IsValid());
+  std::vector<char> content(file.GetLength());
+  ASSERT_EQ(file.Read(0, content.data(), content.size()),
+            static_cast<int>(content.size()));
+  const char* second_power =
+      reinterpret_cast<const char*>(&expected.g1_powers_of_tau()[1]);
+  auto it = std::search(content.begin(), content.end(), second_power,
+                        second_power + sizeof(math::bn254::G1AffinePoint));
+  ASSERT_NE(it, content.end());
+  char byte = *it ^ 1;
+  ASSERT_EQ(file.Write(it - content.begin(), &byte, 1), 1);
+  file.Close();
+  EXPECT_TRUE(pcs.LoadSRSFile(path, 1));
+  EXPECT_FALSE(pcs.LoadSRSFile(path, 2));
+  EXPECT_FALSE(pcs.LoadSRSFile(path));
 }
 
 TEST_F(KZGTest, Copyable) {
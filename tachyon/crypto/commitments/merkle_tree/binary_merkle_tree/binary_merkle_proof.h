@@ -4,6 +4,8 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 
+#include <stddef.h>
+
 #include <vector>
 
 namespace tachyon::crypto {
@@ -33,6 +35,29 @@ struct BinaryMerkleProof {
   }
 };
 
+// |BinaryMerkleMultiProof| proves that many leaves belong to a tree at once.
+// The sibling hashes shared by the paths of the opened leaves are included only
+// once, and the ones that can be computed from the opened leaves themselves are
+// omitted.
+template <typename HashTy>
+struct BinaryMerkleMultiProof {
+  // The indices of the opened leaves in ascending order without duplicates.
+  std::vector<size_t> indices;
+  // The number of levels below the root.
+  size_t depth = 0;
+  // The sibling hashes ordered from the bottom level to the top and by their
+  // positions within each level.
+  std::vector<HashTy> hashes;
+
+  bool operator==(const BinaryMerkleMultiProof& other) const {
+    return indices == other.indices && depth == other.depth &&
+           hashes == other.hashes;
+  }
+  bool operator!=(const BinaryMerkleMultiProof& other) const {
+    return !operator==(other);
+  }
+};
+
 }  // namespace tachyon::crypto
 
 #endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
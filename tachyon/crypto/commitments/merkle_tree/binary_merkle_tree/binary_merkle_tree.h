@@ -14,7 +14,6 @@
 #include "tachyon/base/logging.h"
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/openmp_util.h"
-#include "tachyon/base/range.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_proof.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
@@ -27,6 +26,8 @@ class BinaryMerkleTree
     : public VectorCommitmentScheme<BinaryMerkleTree<LeafTy, HashTy, MaxSize>> {
  public:
   constexpr static size_t kDefaultLeavesSizeForParallelization = 1024;
+  // The minimum number of nodes that a single thread hashes within a level.
+  constexpr static size_t kMinNodesPerChunk = 64;
 
   BinaryMerkleTree() = default;
   BinaryMerkleTree(BinaryMerkleTreeStorage<HashTy>* storage,
@@ -44,7 +45,7 @@ class BinaryMerkleTree
 
  private:
   FRIEND_TEST(BinaryMerkleTreeTest, FillLeaves);
-  FRIEND_TEST(BinaryMerkleTreeTest, BuildTreeFromLeaves);
+  FRIEND_TEST(BinaryMerkleTreeTest, BuildLevel);
 
   friend class VectorCommitmentScheme<
       BinaryMerkleTree<LeafTy, HashTy, MaxSize>>;
@@ -56,27 +57,18 @@ class BinaryMerkleTree
   [[nodiscard]] bool DoCommit(const ContainerTy& leaves, HashTy* out) const {
     if (!FillLeaves(leaves)) return false;
 
-    // For instance, if |leaves_size_for_parallelization_| equals 4, the
-    // subtrees with root indices 1 and 2 will be constructed.
+    // The tree is built level by level from the bottom, and the nodes of each
+    // level are split into contiguous spans that are hashed in parallel. For
+    // instance, if there are 8 leaves, the levels [3, 7), [1, 3) and [0, 1) are
+    // built in this order.
     //
     //         0
     //    1          2
     //  3   4     5    6
     // 7 8 9 10 11 12 13 14
-    //
-    // Finally, the remaining tree should be constructed from leaves 1 and 2.
-    size_t leaves_size = std::size(leaves);
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size;
-                        i += leaves_size_for_parallelization_) {
-      size_t from = leaves_size - 1 + i;
-      size_t to = from + leaves_size_for_parallelization_;
-      BuildTreeFromLeaves(base::Range<size_t>(from, to));
-    }
-    if (leaves_size > leaves_size_for_parallelization_) {
-      size_t i = base::bits::Log2Floor(leaves_size) -
-                 base::bits::Log2Floor(leaves_size_for_parallelization_);
-      BuildTreeFromLeaves(
-          base::Range<size_t>((1 << i) - 1, (1 << (i + 1)) - 1));
+    for (size_t level_size = std::size(leaves) >> 1; level_size > 0;
+         level_size >>= 1) {
+      BuildLevel(level_size);
     }
     *out = storage_->GetHash(0);
     return true;
@@ -85,18 +77,15 @@ class BinaryMerkleTree
   [[nodiscard]] bool DoCreateOpeningProof(
       size_t index, BinaryMerkleProof<HashTy>* proof) const {
     size_t size = storage_->GetSize();
+    const HashTy* hashes = storage_->GetHashes();
     index = (size >> 1) + index;
     proof->paths.resize(base::bits::Log2Floor(size));
     size_t i = 0;
     while (index > 0) {
       BinaryMerklePath<HashTy> path;
-      if (index % 2 == 0) {
-        path.left = true;
-        path.hash = storage_->GetHash(index - 1);
-      } else {
-        path.left = false;
-        path.hash = storage_->GetHash(index + 1);
-      }
+      size_t sibling = index % 2 == 0 ? index - 1 : index + 1;
+      path.left = index % 2 == 0;
+      path.hash = hashes ? hashes[sibling] : storage_->GetHash(sibling);
       proof->paths[i++] = std::move(path);
 
       index = (index - 1) >> 1;
@@ -118,6 +107,123 @@ class BinaryMerkleTree
     return hash == root;
   }
 
+  // Creates a proof that opens the leaves at |indices| at once. |indices| may
+  // be unordered and contain duplicates. The opened leaves must be passed to
+  // |VerifyOpeningProof()| in the order of |proof->indices|.
+  template <typename ContainerTy>
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const ContainerTy& indices, BinaryMerkleMultiProof<HashTy>* proof) const {
+    size_t leaves_size = (storage_->GetSize() + 1) >> 1;
+    std::vector<size_t> positions(std::begin(indices), std::end(indices));
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()),
+                    positions.end());
+    if (positions.empty()) {
+      LOG(ERROR) << "No indices to open";
+      return false;
+    }
+    if (positions.back() >= leaves_size) {
+      LOG(ERROR) << "Index " << positions.back() << " is out of range";
+      return false;
+    }
+
+    const HashTy* hashes = storage_->GetHashes();
+    proof->indices = positions;
+    proof->depth = base::bits::Log2Floor(leaves_size);
+    proof->hashes.clear();
+    for (size_t depth = proof->depth; depth > 0; --depth) {
+      size_t offset = (size_t{1} << depth) - 1;
+      std::vector<size_t> parents;
+      parents.reserve(positions.size());
+      for (size_t i = 0; i < positions.size(); ++i) {
+        size_t position = positions[i];
+        if (position % 2 == 0 && i + 1 < positions.size() &&
+            positions[i + 1] == position + 1) {
+          // The sibling is opened as well, so the verifier can compute it.
+          ++i;
+        } else {
+          size_t sibling = offset + (position ^ 1);
+          proof->hashes.push_back(hashes ? hashes[sibling]
+                                         : storage_->GetHash(sibling));
+        }
+        parents.push_back(position >> 1);
+      }
+      positions = std::move(parents);
+    }
+    return true;
+  }
+
+  // Verifies the multi-opening |proof| in a single bottom-up pass. The hashes
+  // of each level are computed in parallel across the opened leaves.
+  template <typename ContainerTy>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const HashTy& root, const ContainerTy& leaves,
+      const BinaryMerkleMultiProof<HashTy>& proof) const {
+    size_t num_leaves = std::size(leaves);
+    if (num_leaves == 0 || num_leaves != proof.indices.size()) {
+      LOG(ERROR) << "Size of |leaves| and |proof.indices| do not match";
+      return false;
+    }
+    if (proof.depth >= sizeof(size_t) * 8) {
+      LOG(ERROR) << "Depth " << proof.depth << " is too large";
+      return false;
+    }
+    for (size_t i = 0; i < num_leaves; ++i) {
+      if ((i > 0 && proof.indices[i - 1] >= proof.indices[i]) ||
+          proof.indices[i] >= (size_t{1} << proof.depth)) {
+        LOG(ERROR) << "|proof.indices| is not valid";
+        return false;
+      }
+    }
+
+    std::vector<size_t> positions = proof.indices;
+    std::vector<HashTy> hashes(num_leaves);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_leaves; ++i) {
+      hashes[i] = hasher_->ComputeLeafHash(leaves[i]);
+    }
+
+    size_t proof_idx = 0;
+    for (size_t depth = proof.depth; depth > 0; --depth) {
+      std::vector<size_t> parents;
+      std::vector<std::pair<const HashTy*, const HashTy*>> children;
+      parents.reserve(positions.size());
+      children.reserve(positions.size());
+      for (size_t i = 0; i < positions.size(); ++i) {
+        size_t position = positions[i];
+        if (position % 2 == 0 && i + 1 < positions.size() &&
+            positions[i + 1] == position + 1) {
+          children.emplace_back(&hashes[i], &hashes[i + 1]);
+          ++i;
+        } else {
+          if (proof_idx == proof.hashes.size()) {
+            LOG(ERROR) << "|proof.hashes| is too short";
+            return false;
+          }
+          const HashTy* sibling = &proof.hashes[proof_idx++];
+          if (position % 2 == 0) {
+            children.emplace_back(&hashes[i], sibling);
+          } else {
+            children.emplace_back(sibling, &hashes[i]);
+          }
+        }
+        parents.push_back(position >> 1);
+      }
+
+      std::vector<HashTy> parent_hashes(parents.size());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < parents.size(); ++i) {
+        parent_hashes[i] = hasher_->ComputeParentHash(*children[i].first,
+                                                      *children[i].second);
+      }
+      positions = std::move(parents);
+      hashes = std::move(parent_hashes);
+    }
+    if (proof_idx != proof.hashes.size()) {
+      LOG(ERROR) << "|proof.hashes| is too long";
+      return false;
+    }
+    return hashes[0] == root;
+  }
+
   template <typename ContainerTy>
   bool FillLeaves(const ContainerTy& leaves) const {
     size_t leaves_size = std::size(leaves);
@@ -131,21 +237,48 @@ class BinaryMerkleTree
     }
     base::CheckedNumeric<size_t> n = leaves_size;
     storage_->Allocate(((n << 1) - 1).ValueOrDie());
+    HashTy* hashes = storage_->GetHashes();
     OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size; ++i) {
-      storage_->SetHash(leaves_size + i - 1,
-                        hasher_->ComputeLeafHash(leaves[i]));
+      if (hashes) {
+        hashes[leaves_size + i - 1] = hasher_->ComputeLeafHash(leaves[i]);
+      } else {
+        storage_->SetHash(leaves_size + i - 1,
+                          hasher_->ComputeLeafHash(leaves[i]));
+      }
     }
     return true;
   }
 
-  void BuildTreeFromLeaves(base::Range<size_t> range) const {
-    while (range.GetSize() > 0) {
-      for (size_t i = range.from; i < range.to; i += 2) {
-        storage_->SetHash(i >> 1,
-                          hasher_->ComputeParentHash(storage_->GetHash(i),
-                                                     storage_->GetHash(i + 1)));
+  // Computes the |level_size| nodes in [|level_size| - 1, 2 * |level_size| - 1)
+  // from their children. If |level_size| is smaller than
+  // |leaves_size_for_parallelization_|, the level is built on a single thread
+  // since it is too small to amortize the cost of spawning threads.
+  void BuildLevel(size_t level_size) const {
+    HashTy* hashes = storage_->GetHashes();
+    size_t num_chunks = 1;
+#if defined(TACHYON_HAS_OPENMP)
+    if (level_size >= leaves_size_for_parallelization_) {
+      num_chunks = std::min(static_cast<size_t>(omp_get_max_threads()),
+                            level_size / kMinNodesPerChunk);
+      num_chunks = std::max(num_chunks, size_t{1});
+    }
+#endif
+    size_t chunk_size = (level_size + num_chunks - 1) / num_chunks;
+    OPENMP_PARALLEL_FOR(size_t c = 0; c < num_chunks; ++c) {
+      size_t from = level_size - 1 + c * chunk_size;
+      size_t to = std::min(from + chunk_size, (level_size << 1) - 1);
+      if (hashes) {
+        for (size_t i = from; i < to; ++i) {
+          hashes[i] = hasher_->ComputeParentHash(hashes[(i << 1) + 1],
+                                                 hashes[(i << 1) + 2]);
+        }
+      } else {
+        for (size_t i = from; i < to; ++i) {
+          storage_->SetHash(
+              i, hasher_->ComputeParentHash(storage_->GetHash((i << 1) + 1),
+                                            storage_->GetHash((i << 1) + 2)));
+        }
       }
-      range = base::Range<size_t>(range.from >> 1, (range.to >> 1) - 1);
     }
   }
 
@@ -17,6 +17,12 @@ class BinaryMerkleTreeStorage {
   virtual size_t GetSize() const = 0;
   virtual const HashTy& GetHash(size_t i) const = 0;
   virtual void SetHash(size_t i, const HashTy& hash) = 0;
+
+  // Returns the pointer to the hashes if they are stored contiguously in the
+  // order of their indices. If so, |BinaryMerkleTree| reads and writes the
+  // hashes through it directly instead of calling |GetHash()| and |SetHash()|.
+  // Returns nullptr by default.
+  virtual HashTy* GetHashes() { return nullptr; }
 };
 
 }  // namespace tachyon::crypto
@@ -6,6 +6,9 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/flat_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/memory_mapped_binary_merkle_tree_storage.h"
 
 namespace tachyon::crypto {
 
@@ -20,6 +23,18 @@ class SimpleHasher : public BinaryMerkleHasher<int, int> {
   }
 };
 
+// Unlike |SimpleHasher|, the hashes don't overflow however large the tree is.
+class ModularHasher : public BinaryMerkleHasher<int, int> {
+ public:
+  constexpr static int kModulus = 1000003;
+
+  // BinaryMerkleHasher<int, int> methods
+  int ComputeLeafHash(const int& leaf) const override { return leaf; }
+  int ComputeParentHash(const int& left, const int& right) const override {
+    return (left + 2 * right) % kModulus;
+  }
+};
+
 class SimpleMerkleTreeStorage : public BinaryMerkleTreeStorage<int> {
  public:
   const std::vector<int>& hashes() const { return hashes_; }
@@ -64,22 +79,22 @@ TEST_F(BinaryMerkleTreeTest, FillLeaves) {
   EXPECT_FALSE(vcs_.FillLeaves(invalid_leaves));
 }
 
-TEST_F(BinaryMerkleTreeTest, BuildTreeFromLeaves) {
+TEST_F(BinaryMerkleTreeTest, BuildLevel) {
   CreateLeaves();
   ASSERT_TRUE(vcs_.FillLeaves(leaves_));
 
-  vcs_.BuildTreeFromLeaves(base::Range<size_t>(7, 11));
+  vcs_.BuildLevel(4);
   // clang-format off
   std::vector<int> expected_nodes = {
     0,
-    18, 0,
-    2, 8, 0, 0,
+    0, 0,
+    2, 8, 14, 20,
     0, 1, 2, 3, 4, 5, 6, 7,
   };
   // clang-format on
   EXPECT_EQ(storage_.hashes(), expected_nodes);
 
-  vcs_.BuildTreeFromLeaves(base::Range<size_t>(11, 15));
+  vcs_.BuildLevel(2);
   // clang-format off
   expected_nodes = {
     0,
@@ -90,7 +105,7 @@ TEST_F(BinaryMerkleTreeTest, BuildTreeFromLeaves) {
   // clang-format on
   EXPECT_EQ(storage_.hashes(), expected_nodes);
 
-  vcs_.BuildTreeFromLeaves(base::Range<size_t>(1, 3));
+  vcs_.BuildLevel(1);
   // clang-format off
   expected_nodes = {
     126,
@@ -123,4 +138,130 @@ TEST_F(BinaryMerkleTreeTest, CommitAndVerify) {
   ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, 1, proof));
 }
 
+TEST_F(BinaryMerkleTreeTest, CommitAndVerifyMultiOpening) {
+  CreateLeaves();
+
+  int commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+
+  BinaryMerkleMultiProof<int> proof;
+  ASSERT_FALSE(vcs_.CreateOpeningProof(std::vector<size_t>{}, &proof));
+  ASSERT_FALSE(vcs_.CreateOpeningProof(std::vector<size_t>{N}, &proof));
+  ASSERT_TRUE(vcs_.CreateOpeningProof(std::vector<size_t>{5, 1, 0, 5}, &proof));
+
+  BinaryMerkleMultiProof<int> expected_proof;
+  expected_proof.indices = {0, 1, 5};
+  expected_proof.depth = K;
+  expected_proof.hashes = {4, 8, 20};
+  EXPECT_EQ(proof, expected_proof);
+
+  ASSERT_TRUE(
+      vcs_.VerifyOpeningProof(commitment, std::vector<int>{0, 1, 5}, proof));
+  ASSERT_FALSE(
+      vcs_.VerifyOpeningProof(commitment, std::vector<int>{0, 1, 4}, proof));
+  ASSERT_FALSE(
+      vcs_.VerifyOpeningProof(commitment, std::vector<int>{0, 1}, proof));
+
+  BinaryMerkleMultiProof<int> invalid_proof = proof;
+  invalid_proof.hashes.pop_back();
+  ASSERT_FALSE(vcs_.VerifyOpeningProof(commitment, std::vector<int>{0, 1, 5},
+                                       invalid_proof));
+  invalid_proof = proof;
+  invalid_proof.hashes.push_back(0);
+  ASSERT_FALSE(vcs_.VerifyOpeningProof(commitment, std::vector<int>{0, 1, 5},
+                                       invalid_proof));
+  invalid_proof = proof;
+  invalid_proof.indices = {1, 0, 5};
+  ASSERT_FALSE(vcs_.VerifyOpeningProof(commitment, std::vector<int>{1, 0, 5},
+                                       invalid_proof));
+
+  ASSERT_TRUE(vcs_.CreateOpeningProof(base::CreateRangedVector<size_t>(0, N),
+                                      &proof));
+  EXPECT_TRUE(proof.hashes.empty());
+  ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, leaves_, proof));
+}
+
+TEST_F(BinaryMerkleTreeTest, CommitAndVerifyWithFlatStorage) {
+  CreateLeaves();
+
+  FlatBinaryMerkleTreeStorage<int> storage;
+  VCS vcs(&storage, &hasher_);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves_, &commitment));
+  EXPECT_EQ(commitment, 126);
+  EXPECT_EQ(storage.GetLevel(2), absl::MakeConstSpan({2, 8, 14, 20}));
+
+  for (size_t i = 0; i < N; ++i) {
+    BinaryMerkleProof<int> proof;
+    ASSERT_TRUE(vcs.CreateOpeningProof(i, &proof));
+    ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, leaves_[i], proof));
+  }
+}
+
+TEST_F(BinaryMerkleTreeTest, CommitInParallel) {
+  constexpr size_t kLeavesSize = size_t{1} << 12;
+  using LargeVCS = BinaryMerkleTree<int, int, kLeavesSize>;
+
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, kLeavesSize);
+  ModularHasher hasher;
+
+  SimpleMerkleTreeStorage expected_storage;
+  LargeVCS expected_vcs(&expected_storage, &hasher);
+  // Every level is built on a single thread.
+  expected_vcs.set_leaves_size_for_parallelization(kLeavesSize);
+  int expected;
+  ASSERT_TRUE(expected_vcs.Commit(leaves, &expected));
+
+  // The levels with at least |LargeVCS::kMinNodesPerChunk| nodes per thread
+  // are split into chunks that are hashed in parallel, both through
+  // |SetHash()| and through |GetHashes()|.
+  SimpleMerkleTreeStorage storage;
+  LargeVCS vcs(&storage, &hasher);
+  vcs.set_leaves_size_for_parallelization(1);
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+  EXPECT_EQ(commitment, expected);
+  EXPECT_EQ(storage.hashes(), expected_storage.hashes());
+
+  FlatBinaryMerkleTreeStorage<int> flat_storage;
+  LargeVCS flat_vcs(&flat_storage, &hasher);
+  flat_vcs.set_leaves_size_for_parallelization(1);
+  ASSERT_TRUE(flat_vcs.Commit(leaves, &commitment));
+  EXPECT_EQ(commitment, expected);
+  EXPECT_EQ(absl::MakeConstSpan(flat_storage.GetHashes(),
+                                flat_storage.GetSize()),
+            absl::MakeConstSpan(expected_storage.hashes()));
+}
+
+TEST_F(BinaryMerkleTreeTest, CommitAndVerifyWithMemoryMappedStorage) {
+  CreateLeaves();
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("merkle_tree");
+
+  int commitment;
+  {
+    MemoryMappedBinaryMerkleTreeStorage<int> storage(path);
+    VCS vcs(&storage, &hasher_);
+
+    ASSERT_TRUE(vcs.Commit(leaves_, &commitment));
+    EXPECT_EQ(commitment, 126);
+    ASSERT_TRUE(storage.Flush());
+  }
+
+  MemoryMappedBinaryMerkleTreeStorage<int> storage(path);
+  ASSERT_TRUE(storage.Load());
+  EXPECT_EQ(storage.GetSize(), 2 * N - 1);
+  EXPECT_EQ(storage.GetHash(0), commitment);
+
+  VCS vcs(&storage, &hasher_);
+  for (size_t i = 0; i < N; ++i) {
+    BinaryMerkleProof<int> proof;
+    ASSERT_TRUE(vcs.CreateOpeningProof(i, &proof));
+    ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, leaves_[i], proof));
+  }
+}
+
 }  // namespace tachyon::crypto
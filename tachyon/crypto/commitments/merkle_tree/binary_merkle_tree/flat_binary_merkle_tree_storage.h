@@ -0,0 +1,71 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_FLAT_BINARY_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_FLAT_BINARY_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/memory/aligned_memory.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+// |FlatBinaryMerkleTreeStorage| keeps every node of the tree in a single
+// contiguous buffer aligned to a cache line. Nodes are laid out level by level,
+// so that the level at depth d occupies [2ᵈ - 1, 2ᵈ⁺¹ - 1) and each level can
+// be streamed sequentially when the tree is built. Since the buffer is exposed
+// through |GetHashes()|, |BinaryMerkleTree| accesses nodes directly instead of
+// going through virtual |GetHash()|/|SetHash()| calls.
+template <typename HashTy>
+class FlatBinaryMerkleTreeStorage final
+    : public BinaryMerkleTreeStorage<HashTy> {
+ public:
+  constexpr static size_t kAlignment = 64;
+
+  FlatBinaryMerkleTreeStorage() = default;
+  FlatBinaryMerkleTreeStorage(const FlatBinaryMerkleTreeStorage& other) =
+      delete;
+  FlatBinaryMerkleTreeStorage& operator=(
+      const FlatBinaryMerkleTreeStorage& other) = delete;
+  ~FlatBinaryMerkleTreeStorage() override { Release(); }
+
+  // Returns the nodes at |depth|, where the root is at depth 0.
+  absl::Span<const HashTy> GetLevel(size_t depth) const {
+    size_t from = (size_t{1} << depth) - 1;
+    CHECK_LT(from << 1, size_);
+    return absl::MakeConstSpan(&hashes_[from], from + 1);
+  }
+
+  // BinaryMerkleTreeStorage<HashTy> methods
+  void Allocate(size_t size) override {
+    if (size == size_) return;
+    Release();
+    if (size == 0) return;
+    size_t bytes = base::bits::AlignUp(sizeof(HashTy) * size, kAlignment);
+    hashes_.reset(static_cast<HashTy*>(base::AlignedAlloc(bytes, kAlignment)));
+    std::uninitialized_default_construct_n(hashes_.get(), size);
+    size_ = size;
+  }
+  size_t GetSize() const override { return size_; }
+  const HashTy& GetHash(size_t i) const override { return hashes_[i]; }
+  void SetHash(size_t i, const HashTy& hash) override { hashes_[i] = hash; }
+  HashTy* GetHashes() override { return hashes_.get(); }
+
+ private:
+  void Release() {
+    if (hashes_) std::destroy_n(hashes_.get(), size_);
+    hashes_.reset();
+    size_ = 0;
+  }
+
+  std::unique_ptr<HashTy[], base::AlignedFreeDeleter> hashes_;
+  size_t size_ = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_FLAT_BINARY_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,111 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_MEMORY_MAPPED_BINARY_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_MEMORY_MAPPED_BINARY_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/checked_math.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+// |MemoryMappedBinaryMerkleTreeStorage| keeps the nodes of the tree in a file
+// mapped into memory, so that a tree larger than the physical memory can be
+// built and served. The layout is the same as |FlatBinaryMerkleTreeStorage|,
+// which means |BinaryMerkleTree| writes each level sequentially through
+// |GetHashes()| and the OS pages them out to the file as they get cold. The
+// mapping starts at a page boundary, so the kernel is free to back it with
+// huge pages.
+//
+// The file is created (or truncated) on |Allocate()|. A tree that was
+// committed before can be opened again with |Load()| to create opening
+// proofs without recomputing it.
+template <typename HashTy>
+class MemoryMappedBinaryMerkleTreeStorage final
+    : public BinaryMerkleTreeStorage<HashTy> {
+ public:
+  static_assert(std::is_trivially_copyable_v<HashTy>,
+                "HashTy should be trivially copyable to be memory mapped");
+
+  explicit MemoryMappedBinaryMerkleTreeStorage(base::FilePath path)
+      : path_(std::move(path)) {}
+  MemoryMappedBinaryMerkleTreeStorage(
+      const MemoryMappedBinaryMerkleTreeStorage& other) = delete;
+  MemoryMappedBinaryMerkleTreeStorage& operator=(
+      const MemoryMappedBinaryMerkleTreeStorage& other) = delete;
+
+  const base::FilePath& path() const { return path_; }
+
+  // Maps the nodes that were written to |path_| before. Returns false if the
+  // file doesn't exist or its length isn't a multiple of |sizeof(HashTy)|.
+  [[nodiscard]] bool Load() {
+    Release();
+    file_ = std::make_unique<base::MemoryMappedFile>();
+    if (!file_->Initialize(path_, base::MemoryMappedFile::READ_WRITE)) {
+      LOG(ERROR) << "Failed to map " << path_.value();
+      Release();
+      return false;
+    }
+    if (file_->length() % sizeof(HashTy) != 0) {
+      LOG(ERROR) << "The length of " << path_.value()
+                 << " is not a multiple of " << sizeof(HashTy);
+      Release();
+      return false;
+    }
+    size_ = file_->length() / sizeof(HashTy);
+    return true;
+  }
+
+  // Writes the dirty pages back to |path_|. Otherwise, they are written back
+  // whenever the OS decides to, at the latest when this is destroyed.
+  [[nodiscard]] bool Flush() { return file_ && file_->Flush(); }
+
+  // BinaryMerkleTreeStorage<HashTy> methods
+  void Allocate(size_t size) override {
+    if (size == size_) return;
+    Release();
+    if (size == 0) return;
+    base::File file(path_, base::File::FLAG_CREATE_ALWAYS |
+                               base::File::FLAG_READ |
+                               base::File::FLAG_WRITE);
+    CHECK(file.IsValid()) << "Failed to create " << path_.value() << ": "
+                          << base::File::ErrorToString(file.error_details());
+    base::CheckedNumeric<size_t> bytes = size;
+    bytes *= sizeof(HashTy);
+    base::MemoryMappedFile::Region region = {0, bytes.ValueOrDie()};
+    file_ = std::make_unique<base::MemoryMappedFile>();
+    CHECK(file_->Initialize(std::move(file), region,
+                            base::MemoryMappedFile::READ_WRITE_EXTEND))
+        << "Failed to map " << path_.value();
+    size_ = size;
+  }
+  size_t GetSize() const override { return size_; }
+  const HashTy& GetHash(size_t i) const override {
+    return reinterpret_cast<const HashTy*>(file_->data())[i];
+  }
+  void SetHash(size_t i, const HashTy& hash) override { GetHashes()[i] = hash; }
+  HashTy* GetHashes() override {
+    return file_ ? reinterpret_cast<HashTy*>(file_->data()) : nullptr;
+  }
+
+ private:
+  void Release() {
+    file_.reset();
+    size_ = 0;
+  }
+
+  base::FilePath path_;
+  std::unique_ptr<base::MemoryMappedFile> file_;
+  size_t size_ = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_MEMORY_MAPPED_BINARY_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,26 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+namespace tachyon::crypto {
+
+// |MerkleHasher| compresses |Arity| children into their parent at once. With
+// algebraic hashes like Poseidon, a permutation of width t compresses t - 1
+// children at almost the same cost as 2 children.
+template <typename LeafTy, typename HashTy, size_t Arity>
+class MerkleHasher {
+ public:
+  virtual ~MerkleHasher() = default;
+
+  virtual HashTy ComputeLeafHash(const LeafTy& leaf) const = 0;
+
+  // NOTE: The size of |children| is always |Arity|.
+  virtual HashTy ComputeParentHash(absl::Span<const HashTy> children) const = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_HASHER_H_
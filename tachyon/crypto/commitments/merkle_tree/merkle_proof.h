@@ -0,0 +1,38 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_PROOF_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_PROOF_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <vector>
+
+namespace tachyon::crypto {
+
+template <typename HashTy, size_t Arity>
+struct MerklePath {
+  // The position of the node among its siblings.
+  size_t position;
+  // The hashes of the siblings in order, excluding the node itself.
+  std::array<HashTy, Arity - 1> siblings;
+
+  bool operator==(const MerklePath& other) const {
+    return position == other.position && siblings == other.siblings;
+  }
+  bool operator!=(const MerklePath& other) const { return !operator==(other); }
+};
+
+template <typename HashTy, size_t Arity>
+struct MerkleProof {
+  std::vector<MerklePath<HashTy, Arity>> paths;
+
+  bool operator==(const MerkleProof& other) const {
+    return paths == other.paths;
+  }
+  bool operator!=(const MerkleProof& other) const {
+    return paths != other.paths;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_PROOF_H_
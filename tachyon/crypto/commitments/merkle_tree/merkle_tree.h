@@ -0,0 +1,205 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_H_
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "gtest/gtest_prod.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/checked_math.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_hasher.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_proof.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/vector_commitment_scheme.h"
+
+namespace tachyon::crypto {
+
+// |MerkleTree| is a Merkle tree whose every internal node has |Arity|
+// children. The nodes are stored in the breadth-first order, so that the
+// children of the node at i are at [|Arity| * i + 1, |Arity| * i + |Arity|].
+template <typename LeafTy, typename HashTy, size_t Arity, size_t MaxSize>
+class MerkleTree : public VectorCommitmentScheme<
+                       MerkleTree<LeafTy, HashTy, Arity, MaxSize>> {
+ public:
+  static_assert(Arity >= 2, "Arity should be greater than or equal to 2");
+
+  constexpr static size_t kArity = Arity;
+  constexpr static size_t kDefaultLeavesSizeForParallelization = 1024;
+  // The minimum number of nodes that a single thread hashes within a level.
+  constexpr static size_t kMinNodesPerChunk = 64;
+
+  MerkleTree() = default;
+  MerkleTree(MerkleTreeStorage<HashTy>* storage,
+             MerkleHasher<LeafTy, HashTy, Arity>* hasher)
+      : storage_(storage), hasher_(hasher) {}
+
+  size_t leaves_size_for_parallelization() const {
+    return leaves_size_for_parallelization_;
+  }
+  void set_leaves_size_for_parallelization(
+      size_t leaves_size_for_parallelization) {
+    leaves_size_for_parallelization_ = leaves_size_for_parallelization;
+  }
+
+  // Returns true if |n| is a power of |Arity|.
+  constexpr static bool IsPowerOfArity(size_t n) {
+    if (n == 0) return false;
+    while (n % Arity == 0) {
+      n /= Arity;
+    }
+    return n == 1;
+  }
+
+ private:
+  FRIEND_TEST(MerkleTreeTest, FillLeaves);
+  FRIEND_TEST(MerkleTreeTest, BuildLevel);
+
+  friend class VectorCommitmentScheme<
+      MerkleTree<LeafTy, HashTy, Arity, MaxSize>>;
+
+  // VectorCommitmentScheme methods
+  size_t N() const { return MaxSize; }
+
+  template <typename ContainerTy>
+  [[nodiscard]] bool DoCommit(const ContainerTy& leaves, HashTy* out) const {
+    if (!FillLeaves(leaves)) return false;
+
+    // Like |BinaryMerkleTree|, the tree is built level by level from the
+    // bottom and each level is hashed in parallel.
+    for (size_t level_size = std::size(leaves) / Arity; level_size > 0;
+         level_size /= Arity) {
+      BuildLevel(level_size);
+    }
+    *out = storage_->GetHash(0);
+    return true;
+  }
+
+  [[nodiscard]] bool DoCreateOpeningProof(
+      size_t index, MerkleProof<HashTy, Arity>* proof) const {
+    size_t size = storage_->GetSize();
+    size_t leaves_size = (size * (Arity - 1) + 1) / Arity;
+    if (index >= leaves_size) {
+      LOG(ERROR) << "Index " << index << " is out of range";
+      return false;
+    }
+    const HashTy* hashes = storage_->GetHashes();
+    index = (leaves_size - 1) / (Arity - 1) + index;
+    proof->paths.clear();
+    while (index > 0) {
+      size_t parent = (index - 1) / Arity;
+      size_t first_child = parent * Arity + 1;
+      MerklePath<HashTy, Arity> path;
+      path.position = index - first_child;
+      for (size_t i = 0, j = 0; i < Arity; ++i) {
+        if (i == path.position) continue;
+        path.siblings[j++] = hashes ? hashes[first_child + i]
+                                    : storage_->GetHash(first_child + i);
+      }
+      proof->paths.push_back(std::move(path));
+      index = parent;
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const HashTy& root, const LeafTy& leaf,
+      const MerkleProof<HashTy, Arity>& proof) const {
+    HashTy hash = hasher_->ComputeLeafHash(leaf);
+    std::array<HashTy, Arity> children;
+    for (const MerklePath<HashTy, Arity>& path : proof.paths) {
+      if (path.position >= Arity) return false;
+      for (size_t i = 0, j = 0; i < Arity; ++i) {
+        children[i] = i == path.position ? hash : path.siblings[j++];
+      }
+      hash = hasher_->ComputeParentHash(children);
+    }
+    return hash == root;
+  }
+
+  template <typename ContainerTy>
+  bool FillLeaves(const ContainerTy& leaves) const {
+    size_t leaves_size = std::size(leaves);
+    if (!IsPowerOfArity(leaves_size)) {
+      LOG(ERROR) << leaves_size << " is not a power of " << Arity;
+      return false;
+    }
+    if (leaves_size > MaxSize) {
+      LOG(ERROR) << "Too many leaves";
+      return false;
+    }
+    base::CheckedNumeric<size_t> n = leaves_size;
+    storage_->Allocate(((n * Arity - 1) / (Arity - 1)).ValueOrDie());
+    size_t offset = (leaves_size - 1) / (Arity - 1);
+    HashTy* hashes = storage_->GetHashes();
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size; ++i) {
+      if (hashes) {
+        hashes[offset + i] = hasher_->ComputeLeafHash(leaves[i]);
+      } else {
+        storage_->SetHash(offset + i, hasher_->ComputeLeafHash(leaves[i]));
+      }
+    }
+    return true;
+  }
+
+  // Computes the |level_size| nodes starting at (|level_size| - 1) /
+  // (|Arity| - 1) from their children. If |level_size| is smaller than
+  // |leaves_size_for_parallelization_|, the level is built on a single thread.
+  void BuildLevel(size_t level_size) const {
+    HashTy* hashes = storage_->GetHashes();
+    size_t offset = (level_size - 1) / (Arity - 1);
+    size_t num_chunks = 1;
+#if defined(TACHYON_HAS_OPENMP)
+    if (level_size >= leaves_size_for_parallelization_) {
+      num_chunks = std::min(static_cast<size_t>(omp_get_max_threads()),
+                            level_size / kMinNodesPerChunk);
+      num_chunks = std::max(num_chunks, size_t{1});
+    }
+#endif
+    size_t chunk_size = (level_size + num_chunks - 1) / num_chunks;
+    OPENMP_PARALLEL_FOR(size_t c = 0; c < num_chunks; ++c) {
+      size_t from = offset + c * chunk_size;
+      size_t to = std::min(from + chunk_size, offset + level_size);
+      if (hashes) {
+        for (size_t i = from; i < to; ++i) {
+          hashes[i] = hasher_->ComputeParentHash(
+              absl::MakeConstSpan(&hashes[i * Arity + 1], Arity));
+        }
+      } else {
+        std::array<HashTy, Arity> children;
+        for (size_t i = from; i < to; ++i) {
+          for (size_t j = 0; j < Arity; ++j) {
+            children[j] = storage_->GetHash(i * Arity + 1 + j);
+          }
+          storage_->SetHash(i, hasher_->ComputeParentHash(children));
+        }
+      }
+    }
+  }
+
+  // not owned
+  mutable MerkleTreeStorage<HashTy>* storage_ = nullptr;
+  // not owned
+  MerkleHasher<LeafTy, HashTy, Arity>* hasher_ = nullptr;
+  size_t leaves_size_for_parallelization_ =
+      kDefaultLeavesSizeForParallelization;
+};
+
+template <typename LeafTy, typename HashTy, size_t Arity, size_t MaxSize>
+struct VectorCommitmentSchemeTraits<
+    MerkleTree<LeafTy, HashTy, Arity, MaxSize>> {
+ public:
+  constexpr static size_t kMaxSize = MaxSize;
+  constexpr static bool kIsTransparent = true;
+
+  using Field = HashTy;
+  using Commitment = HashTy;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_H_
@@ -0,0 +1,133 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree_storage.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxSize = size_t{1} << 26;
+
+// Compresses children with a Poseidon permutation whose rate is the number of
+// the children. A sponge is kept per thread and only its state is reset for
+// each hash, since constructing one copies the whole config.
+template <size_t Arity>
+class PoseidonMerkleHasher : public MerkleHasher<F, F, Arity>,
+                             public BinaryMerkleHasher<F, F> {
+ public:
+  PoseidonMerkleHasher() {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    PoseidonConfig<F> config = PoseidonConfig<F>::CreateDefault(Arity, false);
+    sponges_ = base::CreateVector(
+        thread_nums, [&config]() { return PoseidonSponge<F>(config); });
+  }
+
+  // MerkleHasher<F, F, Arity> methods
+  F ComputeLeafHash(const F& leaf) const override { return leaf; }
+  F ComputeParentHash(absl::Span<const F> children) const override {
+#if defined(TACHYON_HAS_OPENMP)
+    PoseidonSponge<F>& sponge = sponges_[omp_get_thread_num()];
+#else
+    PoseidonSponge<F>& sponge = sponges_[0];
+#endif  // defined(TACHYON_HAS_OPENMP)
+    for (F& elem : sponge.state.elements) {
+      elem = F::Zero();
+    }
+    sponge.state.mode = DuplexSpongeMode::Absorbing();
+    CHECK(sponge.Absorb(children));
+    return sponge.SqueezeNativeFieldElements(1)[0];
+  }
+
+  // BinaryMerkleHasher<F, F> methods
+  F ComputeParentHash(const F& left, const F& right) const override {
+    return ComputeParentHash(absl::MakeConstSpan({left, right}));
+  }
+
+ private:
+  mutable std::vector<PoseidonSponge<F>> sponges_;
+};
+
+// Both trees keep their nodes in the same contiguous buffer so that only the
+// tree layout and the hashing differ between the benchmarks.
+class VectorMerkleTreeStorage : public MerkleTreeStorage<F>,
+                                public BinaryMerkleTreeStorage<F> {
+ public:
+  // MerkleTreeStorage<F> and BinaryMerkleTreeStorage<F> methods
+  void Allocate(size_t size) override { hashes_.resize(size); }
+  size_t GetSize() const override { return hashes_.size(); }
+  const F& GetHash(size_t i) const override { return hashes_[i]; }
+  void SetHash(size_t i, const F& hash) override { hashes_[i] = hash; }
+  F* GetHashes() override { return hashes_.data(); }
+
+ private:
+  std::vector<F> hashes_;
+};
+
+std::vector<F> CreateLeaves(size_t size) {
+  return base::CreateVector(size, []() { return F::Random(); });
+}
+
+}  // namespace
+
+void BM_BinaryMerkleTree(benchmark::State& state) {
+  F::Init();
+  std::vector<F> leaves = CreateLeaves(state.range(0));
+  VectorMerkleTreeStorage storage;
+  PoseidonMerkleHasher<2> hasher;
+  BinaryMerkleTree<F, F, kMaxSize> tree(&storage, &hasher);
+  F commitment;
+  for (auto _ : state) {
+    CHECK(tree.Commit(leaves, &commitment));
+  }
+  benchmark::DoNotOptimize(commitment);
+}
+
+template <size_t Arity>
+void BM_MerkleTree(benchmark::State& state) {
+  F::Init();
+  std::vector<F> leaves = CreateLeaves(state.range(0));
+  VectorMerkleTreeStorage storage;
+  PoseidonMerkleHasher<Arity> hasher;
+  MerkleTree<F, F, Arity, kMaxSize> tree(&storage, &hasher);
+  F commitment;
+  for (auto _ : state) {
+    CHECK(tree.Commit(leaves, &commitment));
+  }
+  benchmark::DoNotOptimize(commitment);
+}
+
+BENCHMARK(BM_BinaryMerkleTree)
+    ->RangeMultiplier(2)
+    ->Range(1 << 20, 1 << 26)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MerkleTree, 2)
+    ->RangeMultiplier(2)
+    ->Range(1 << 20, 1 << 26)
+    ->Unit(benchmark::kMillisecond);
+// The number of leaves must be a power of the arity.
+BENCHMARK_TEMPLATE(BM_MerkleTree, 4)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 26)
+    ->Unit(benchmark::kMillisecond);
+// 2²¹ and 2²⁴ are the only powers of 8 between 2²⁰ and 2²⁶.
+BENCHMARK_TEMPLATE(BM_MerkleTree, 8)
+    ->Arg(1 << 21)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::crypto
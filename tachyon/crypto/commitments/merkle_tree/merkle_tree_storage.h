@@ -0,0 +1,27 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+namespace tachyon::crypto {
+
+template <typename HashTy>
+class MerkleTreeStorage {
+ public:
+  virtual ~MerkleTreeStorage() = default;
+
+  virtual void Allocate(size_t size) = 0;
+  virtual size_t GetSize() const = 0;
+  virtual const HashTy& GetHash(size_t i) const = 0;
+  virtual void SetHash(size_t i, const HashTy& hash) = 0;
+
+  // Returns the pointer to the hashes if they are stored contiguously in the
+  // order of their indices. If so, |MerkleTree| reads and writes the hashes
+  // through it directly and passes the children to the hasher without copying
+  // them. Returns nullptr by default.
+  virtual HashTy* GetHashes() { return nullptr; }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,191 @@
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+template <size_t Arity>
+class SimpleHasher : public MerkleHasher<int, int, Arity> {
+ public:
+  // MerkleHasher<int, int, Arity> methods
+  int ComputeLeafHash(const int& leaf) const override { return leaf; }
+  int ComputeParentHash(absl::Span<const int> children) const override {
+    int ret = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      ret += static_cast<int>(i + 1) * children[i];
+    }
+    return ret;
+  }
+};
+
+// Unlike |SimpleHasher|, the hashes don't overflow however large the tree is.
+template <size_t Arity>
+class ModularHasher : public MerkleHasher<int, int, Arity> {
+ public:
+  constexpr static int kModulus = 1000003;
+
+  // MerkleHasher<int, int, Arity> methods
+  int ComputeLeafHash(const int& leaf) const override { return leaf; }
+  int ComputeParentHash(absl::Span<const int> children) const override {
+    int ret = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      ret = (ret + static_cast<int>(i + 1) * children[i]) % kModulus;
+    }
+    return ret;
+  }
+};
+
+class SimpleMerkleTreeStorage : public MerkleTreeStorage<int> {
+ public:
+  explicit SimpleMerkleTreeStorage(bool expose_hashes = false)
+      : expose_hashes_(expose_hashes) {}
+
+  const std::vector<int>& hashes() const { return hashes_; }
+
+  // MerkleTreeStorage<int> methods
+  void Allocate(size_t size) override { hashes_.resize(size); }
+  size_t GetSize() const override { return hashes_.size(); }
+  const int& GetHash(size_t i) const override { return hashes_[i]; }
+  void SetHash(size_t i, const int& hash) override { hashes_[i] = hash; }
+  int* GetHashes() override {
+    return expose_hashes_ ? hashes_.data() : nullptr;
+  }
+
+ private:
+  bool expose_hashes_;
+  std::vector<int> hashes_;
+};
+
+class MerkleTreeTest : public testing::Test {
+ public:
+  constexpr static size_t kArity = 4;
+  constexpr static size_t K = 2;
+  constexpr static size_t N = size_t{1} << (2 * K);
+
+  using VCS = MerkleTree<int, int, kArity, N>;
+
+  void SetUp() override {
+    vcs_ = VCS(&storage_, &hasher_);
+    vcs_.set_leaves_size_for_parallelization(kArity);
+  };
+
+  void CreateLeaves() { leaves_ = base::CreateRangedVector<int>(0, N); }
+
+ protected:
+  SimpleMerkleTreeStorage storage_;
+  SimpleHasher<kArity> hasher_;
+  VCS vcs_;
+  std::vector<int> leaves_;
+};
+
+}  // namespace
+
+TEST_F(MerkleTreeTest, IsPowerOfArity) {
+  EXPECT_FALSE(VCS::IsPowerOfArity(0));
+  EXPECT_TRUE(VCS::IsPowerOfArity(1));
+  EXPECT_FALSE(VCS::IsPowerOfArity(2));
+  EXPECT_TRUE(VCS::IsPowerOfArity(4));
+  EXPECT_FALSE(VCS::IsPowerOfArity(8));
+  EXPECT_TRUE(VCS::IsPowerOfArity(16));
+}
+
+TEST_F(MerkleTreeTest, FillLeaves) {
+  std::vector<int> invalid_leaves = base::CreateRangedVector<int>(0, N >> 1);
+  EXPECT_FALSE(vcs_.FillLeaves(invalid_leaves));
+  invalid_leaves = base::CreateRangedVector<int>(0, N * kArity);
+  EXPECT_FALSE(vcs_.FillLeaves(invalid_leaves));
+}
+
+TEST_F(MerkleTreeTest, BuildLevel) {
+  CreateLeaves();
+  ASSERT_TRUE(vcs_.FillLeaves(leaves_));
+
+  vcs_.BuildLevel(4);
+  // clang-format off
+  std::vector<int> expected_nodes = {
+    0,
+    20, 60, 100, 140,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  };
+  // clang-format on
+  EXPECT_EQ(storage_.hashes(), expected_nodes);
+
+  vcs_.BuildLevel(1);
+  expected_nodes[0] = 1000;
+  EXPECT_EQ(storage_.hashes(), expected_nodes);
+}
+
+TEST_F(MerkleTreeTest, CommitAndVerify) {
+  CreateLeaves();
+
+  for (bool expose_hashes : {false, true}) {
+    SimpleMerkleTreeStorage storage(expose_hashes);
+    VCS vcs(&storage, &hasher_);
+
+    int commitment;
+    ASSERT_TRUE(vcs.Commit(leaves_, &commitment));
+    EXPECT_EQ(commitment, 1000);
+
+    MerkleProof<int, kArity> proof;
+    ASSERT_FALSE(vcs.CreateOpeningProof(N, &proof));
+    ASSERT_TRUE(vcs.CreateOpeningProof(6, &proof));
+
+    MerkleProof<int, kArity> expected_proof;
+    expected_proof.paths = std::vector<MerklePath<int, kArity>>{
+        {2, {4, 5, 7}},
+        {1, {20, 100, 140}},
+    };
+    EXPECT_EQ(proof, expected_proof);
+
+    ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, 6, proof));
+    ASSERT_FALSE(vcs.VerifyOpeningProof(commitment, 7, proof));
+  }
+}
+
+TEST_F(MerkleTreeTest, CommitInParallel) {
+  constexpr size_t kLeavesSize = size_t{1} << 12;
+  using LargeVCS = MerkleTree<int, int, kArity, kLeavesSize>;
+
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, kLeavesSize);
+  ModularHasher<kArity> hasher;
+
+  SimpleMerkleTreeStorage expected_storage;
+  LargeVCS expected_vcs(&expected_storage, &hasher);
+  // Every level is built on a single thread.
+  expected_vcs.set_leaves_size_for_parallelization(kLeavesSize);
+  int expected;
+  ASSERT_TRUE(expected_vcs.Commit(leaves, &expected));
+
+  // The levels with at least |LargeVCS::kMinNodesPerChunk| nodes per thread
+  // are split into chunks that are hashed in parallel.
+  for (bool expose_hashes : {false, true}) {
+    SimpleMerkleTreeStorage storage(expose_hashes);
+    LargeVCS vcs(&storage, &hasher);
+    vcs.set_leaves_size_for_parallelization(1);
+    int commitment;
+    ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+    EXPECT_EQ(commitment, expected);
+    EXPECT_EQ(storage.hashes(), expected_storage.hashes());
+  }
+}
+
+TEST_F(MerkleTreeTest, BinaryArity) {
+  SimpleMerkleTreeStorage storage;
+  SimpleHasher<2> hasher;
+  MerkleTree<int, int, 2, 8> vcs(&storage, &hasher);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(base::CreateRangedVector<int>(0, 8), &commitment));
+  EXPECT_EQ(commitment, 126);
+
+  MerkleProof<int, 2> proof;
+  ASSERT_TRUE(vcs.CreateOpeningProof(1, &proof));
+  EXPECT_EQ(proof.paths.size(), size_t{3});
+  ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, 1, proof));
+}
+
+}  // namespace tachyon::crypto
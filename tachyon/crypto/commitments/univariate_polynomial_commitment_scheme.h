@@ -3,6 +3,11 @@
 
 #include <stddef.h>
 
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -41,6 +46,35 @@ class UnivariatePolynomialCommitmentScheme
     const Derived* derived = static_cast<const Derived*>(this);
     return derived->DoCommitLagrange(evals.evaluations(), result);
   }
+
+  // Commit to each of |polys| and populates |results| with the commitments.
+  // This is faster than committing to them one by one, because the same bases
+  // are shared by every commitment.
+  [[nodiscard]] bool CommitBatch(const std::vector<Poly>& polys,
+                                 std::vector<Commitment>* results) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoCommitBatch(
+        base::Map(polys,
+                  [](const Poly& poly) {
+                    return absl::MakeConstSpan(
+                        poly.coefficients().coefficients());
+                  }),
+        results);
+  }
+
+  // Commit to each of |evals_vec| and populates |results| with the
+  // commitments. See |CommitBatch()|.
+  [[nodiscard]] bool CommitLagrangeBatch(
+      const std::vector<Evals>& evals_vec,
+      std::vector<Commitment>* results) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoCommitLagrangeBatch(
+        base::Map(evals_vec,
+                  [](const Evals& evals) {
+                    return absl::MakeConstSpan(evals.evaluations());
+                  }),
+        results);
+  }
 };
 
 }  // namespace tachyon::crypto
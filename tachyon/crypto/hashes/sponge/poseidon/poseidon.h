@@ -6,9 +6,12 @@
 #ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_H_
 #define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_H_
 
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/hashes/prime_field_serializable.h"
@@ -106,7 +109,7 @@ struct PoseidonSponge
   }
 
   // Absorbs everything in |elements|, this does not end in an absorbing.
-  void AbsorbInternal(size_t rate_start_index, const std::vector<F>& elements) {
+  void AbsorbInternal(size_t rate_start_index, absl::Span<const F> elements) {
     size_t elements_idx = 0;
     while (true) {
       size_t remaining_size = elements.size() - elements_idx;
@@ -165,9 +168,24 @@ struct PoseidonSponge
   // CryptographicSponge methods
   template <typename T>
   bool Absorb(const T& input) {
-    std::vector<F> elements;
-    if (!SerializeToFieldElements(input, &elements)) return false;
+    // Native field elements are absorbed in place without being serialized
+    // into a temporary vector.
+    if constexpr (std::is_same_v<T, F>) {
+      AbsorbFieldElements(absl::MakeConstSpan(&input, 1));
+      return true;
+    } else if constexpr (std::is_constructible_v<absl::Span<const F>,
+                                                 const T&>) {
+      AbsorbFieldElements(absl::Span<const F>(input));
+      return true;
+    } else {
+      std::vector<F> elements;
+      if (!SerializeToFieldElements(input, &elements)) return false;
+      AbsorbFieldElements(elements);
+      return true;
+    }
+  }
 
+  void AbsorbFieldElements(absl::Span<const F> elements) {
     switch (state.mode.type) {
       case DuplexSpongeMode::Type::kAbsorbing: {
         size_t absorb_index = state.mode.next_index;
@@ -176,16 +194,15 @@ struct PoseidonSponge
           absorb_index = 0;
         }
         AbsorbInternal(absorb_index, elements);
-        return true;
+        return;
       }
       case DuplexSpongeMode::Type::kSqueezing: {
         Permute();
         AbsorbInternal(0, elements);
-        return true;
+        return;
       }
     }
     NOTREACHED();
-    return false;
   }
 
   std::vector<uint8_t> SqueezeBytes(size_t num_bytes) {
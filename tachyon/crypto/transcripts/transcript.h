@@ -9,6 +9,8 @@
 
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/vector_buffer.h"
 #include "tachyon/crypto/transcripts/transcript_traits.h"
 
@@ -44,6 +46,28 @@ class TranscriptImpl<_Commitment, false> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |commitments| to the transcript without writing them to the proof,
+  // treating them as common inputs. Implementations may override it to absorb
+  // them into the hash state at once.
+  [[nodiscard]] virtual bool WriteManyToTranscript(
+      absl::Span<const Commitment> commitments) {
+    for (const Commitment& commitment : commitments) {
+      if (!WriteToTranscript(commitment)) return false;
+    }
+    return true;
+  }
+
+  // Write |values| to the transcript without writing them to the proof,
+  // treating them as common inputs. Implementations may override it to absorb
+  // them into the hash state at once.
+  [[nodiscard]] virtual bool WriteManyToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Commitment, false>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Commitment, false>*>(this);
   }
@@ -67,6 +91,17 @@ class TranscriptImpl<_Field, true> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |values| to the transcript without writing them to the proof,
+  // treating them as common inputs. Implementations may override it to absorb
+  // them into the hash state at once.
+  [[nodiscard]] virtual bool WriteManyToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Field, true>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Field, true>*>(this);
   }
@@ -107,6 +142,14 @@ class TranscriptReaderImpl<Commitment, false> : public Transcript<Commitment> {
     return DoReadFromProof(value) && this->WriteToTranscript(*value);
   }
 
+  // Read |commitments| from the proof. Note that it also writes the
+  // |commitments| to the transcript by calling |WriteManyToTranscript()|
+  // internally.
+  [[nodiscard]] bool ReadManyFromProof(absl::Span<Commitment> commitments) {
+    return DoReadManyFromProof(commitments) &&
+           this->WriteManyToTranscript(commitments);
+  }
+
  protected:
   //  Read a |commitment| from the proof.
   [[nodiscard]] virtual bool DoReadFromProof(Commitment* commitment) const = 0;
@@ -114,6 +157,15 @@ class TranscriptReaderImpl<Commitment, false> : public Transcript<Commitment> {
   //  Read a |value| from the proof.
   [[nodiscard]] virtual bool DoReadFromProof(Field* value) const = 0;
 
+  //  Read |commitments| from the proof.
+  [[nodiscard]] virtual bool DoReadManyFromProof(
+      absl::Span<Commitment> commitments) const {
+    for (Commitment& commitment : commitments) {
+      if (!DoReadFromProof(&commitment)) return false;
+    }
+    return true;
+  }
+
   base::Buffer buffer_;
 };
 
@@ -173,6 +225,28 @@ class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |commitments| to the proof. Note that it also writes the
+  // |commitments| to the transcript by calling |WriteManyToTranscript()|
+  // internally.
+  [[nodiscard]] bool WriteManyToProof(
+      absl::Span<const Commitment> commitments) {
+    if (!this->WriteManyToTranscript(commitments)) return false;
+    for (const Commitment& commitment : commitments) {
+      if (!DoWriteToProof(commitment)) return false;
+    }
+    return true;
+  }
+
+  // Write |values| to the proof. Note that it also writes the |values| to the
+  // transcript by calling |WriteManyToTranscript()| internally.
+  [[nodiscard]] bool WriteManyToProof(absl::Span<const Field> values) {
+    if (!this->WriteManyToTranscript(values)) return false;
+    for (const Field& value : values) {
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
  protected:
   //  Write a |commitment| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Commitment& commitment) = 0;
@@ -202,6 +276,16 @@ class TranscriptWriterImpl<Field, true> : public Transcript<Field> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |values| to the proof. Note that it also writes the |values| to the
+  // transcript by calling |WriteManyToTranscript()| internally.
+  [[nodiscard]] bool WriteManyToProof(absl::Span<const Field> values) {
+    if (!this->WriteManyToTranscript(values)) return false;
+    for (const Field& value : values) {
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
  protected:
   //  Write a |value| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Field& value) = 0;
@@ -0,0 +1,54 @@
+#include "tachyon/crypto/transcripts/transcript.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using namespace math::bn254;
+
+class TranscriptTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(TranscriptTest, WriteMany) {
+  std::vector<G1AffinePoint> points = {G1AffinePoint::Random(),
+                                       G1AffinePoint::Random()};
+  std::vector<Fr> scalars = {Fr::Random(), Fr::Random(), Fr::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  SimpleTranscriptWriter<G1AffinePoint> writer(std::move(write_buf));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(writer.WriteToProof(scalar));
+  }
+
+  base::Uint8VectorBuffer write_buf2;
+  SimpleTranscriptWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  ASSERT_TRUE(writer2.WriteManyToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer2.WriteManyToProof(absl::MakeConstSpan(scalars)));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(), writer2.buffer().owned_buffer());
+  EXPECT_EQ(writer.SqueezeChallenge(), writer2.SqueezeChallenge());
+
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  SimpleTranscriptReader<G1AffinePoint> reader(std::move(read_buf));
+  std::vector<G1AffinePoint> points_read(points.size());
+  ASSERT_TRUE(reader.ReadManyFromProof(absl::MakeSpan(points_read)));
+
+  EXPECT_EQ(points_read, points);
+}
+
+}  // namespace tachyon::crypto
@@ -1,11 +1,13 @@
 #ifndef TACHYON_MATH_BASE_GROUPS_H_
 #define TACHYON_MATH_BASE_GROUPS_H_
 
+#include <algorithm>
 #include <limits>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/adapters.h"
@@ -91,6 +93,15 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
     return BatchInverse(groups, &groups, coeff);
   }
 
+  // Same as above, but |scratch| is used as the working memory, so that the
+  // caller can reuse it across calls.
+  template <typename Container>
+  constexpr static bool BatchInverseInPlace(Container& groups,
+                                            std::vector<G>* scratch,
+                                            const G& coeff = G::One()) {
+    return BatchInverse(groups, &groups, scratch, coeff);
+  }
+
   template <typename Container>
   constexpr static bool BatchInverseInPlaceSerial(Container& groups,
                                                   const G& coeff = G::One()) {
@@ -100,42 +111,68 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
   // This is taken and modified from
   // https://github.com/arkworks-rs/algebra/blob/5dfeedf560da6937a5de0a2163b7958bd32cd551/ff/src/fields/mod.rs#L355-L418.
   // Batch inverse: [a₁, a₂, ..., aₙ] -> [a₁⁻¹, a₂⁻¹, ... , aₙ⁻¹]
+  // The zeros are mapped to zeros.
   template <typename InputContainer, typename OutputContainer>
   constexpr static bool BatchInverse(const InputContainer& groups,
                                      OutputContainer* inverses,
                                      const G& coeff = G::One()) {
+    std::vector<G> scratch;
+    return BatchInverse(groups, inverses, &scratch, coeff);
+  }
+
+  // Same as above, but |scratch| is used as the working memory, so that the
+  // caller can reuse it across calls. It's only needed when |groups| and
+  // |inverses| are the same, otherwise |inverses| serves as the working memory
+  // and |scratch| is left untouched.
+  template <typename InputContainer, typename OutputContainer>
+  constexpr static bool BatchInverse(const InputContainer& groups,
+                                     OutputContainer* inverses,
+                                     std::vector<G>* scratch,
+                                     const G& coeff = G::One()) {
     if (std::size(groups) != std::size(*inverses)) {
       LOG(ERROR) << "Size of |groups| and |inverses| do not match";
       return false;
     }
 
+    absl::Span<const G> groups_span = absl::MakeConstSpan(groups);
+    absl::Span<G> inverses_span = absl::MakeSpan(*inverses);
+    absl::Span<G> prefixes = GetPrefixes(groups_span, inverses_span, scratch);
+
 #if defined(TACHYON_HAS_OPENMP)
-    using G2 = decltype(std::declval<G>().Inverse());
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-    if (std::size(groups) >=
-        size_t{1} << (thread_nums / kParallelBatchInverseDivisorThreshold)) {
-      size_t num_elem_per_thread =
-          (std::size(groups) + thread_nums - 1) / thread_nums;
-
-      auto groups_chunks = base::Chunked(groups, num_elem_per_thread);
-      auto inverses_chunks = base::Chunked(*inverses, num_elem_per_thread);
-      auto zipped = base::Zipped(groups_chunks, inverses_chunks);
-      auto zipped_vector = base::Map(
-          zipped.begin(), zipped.end(),
-          [](const std::tuple<absl::Span<const G2>, absl::Span<G2>>& v) {
-            return v;
-          });
+    size_t num_chunks =
+        std::min(static_cast<size_t>(omp_get_max_threads()),
+                 groups_span.size() / kMinParallelBatchInverseChunkSize);
+    if (num_chunks > 1) {
+      size_t chunk_size = (groups_span.size() + num_chunks - 1) / num_chunks;
+      num_chunks = (groups_span.size() + chunk_size - 1) / chunk_size;
 
+      // First pass: compute the prefix products of each chunk in parallel.
+      std::vector<G> chunk_products(num_chunks);
 #pragma omp parallel for
-      for (size_t i = 0; i < zipped_vector.size(); ++i) {
-        const auto& [fields_chunk, inverses_chunk] = zipped_vector[i];
-        DoBatchInverse(fields_chunk, inverses_chunk, coeff);
+      for (size_t i = 0; i < num_chunks; ++i) {
+        size_t offset = i * chunk_size;
+        chunk_products[i] =
+            ComputePrefixProducts(groups_span.subspan(offset, chunk_size),
+                                  prefixes.subspan(offset, chunk_size));
+      }
+
+      // Invert the products of the chunks with a single inversion. None of
+      // them is zero, since the zeros are skipped.
+      BatchInverseInPlaceSerial(chunk_products, coeff);
+
+      // Second pass: compute the inverses of each chunk in parallel.
+#pragma omp parallel for
+      for (size_t i = 0; i < num_chunks; ++i) {
+        size_t offset = i * chunk_size;
+        BackSubstitute(groups_span.subspan(offset, chunk_size),
+                       inverses_span.subspan(offset, chunk_size),
+                       prefixes.subspan(offset, chunk_size),
+                       chunk_products[i]);
       }
       return true;
     }
 #endif
-    DoBatchInverse(absl::MakeConstSpan(groups), absl::MakeSpan(*inverses),
-                   coeff);
+    DoBatchInverse(groups_span, inverses_span, prefixes, coeff);
     return true;
   }
 
@@ -147,38 +184,44 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
       LOG(ERROR) << "Size of |groups| and |inverses| do not match";
       return false;
     }
-    DoBatchInverse(absl::MakeConstSpan(groups), absl::MakeSpan(*inverses),
-                   coeff);
+    absl::Span<const G> groups_span = absl::MakeConstSpan(groups);
+    absl::Span<G> inverses_span = absl::MakeSpan(*inverses);
+    std::vector<G> scratch;
+    DoBatchInverse(groups_span, inverses_span,
+                   GetPrefixes(groups_span, inverses_span, &scratch), coeff);
     return true;
   }
 
  private:
-  // NOTE(chokobole): This value was chosen empirically that
-  // |batch_inverse_benchmark| performs better at fewer input compared to the
-  // number of cpu cores.
-  constexpr static size_t kParallelBatchInverseDivisorThreshold = 4;
+  // NOTE(chokobole): This value was chosen so that the work of each thread
+  // outweighs the cost of forking it. The batch is split into at most as many
+  // chunks as the threads, and each chunk has at least this many elements.
+  constexpr static size_t kMinParallelBatchInverseChunkSize = 256;
 
   FRIEND_TEST(GroupsTest, BatchInverse);
 
-  constexpr static void DoBatchInverse(absl::Span<const G> groups,
-                                       absl::Span<G> inverses, const G& coeff) {
-    // Montgomery’s Trick and Fast Implementation of Masked AES
-    // Genelle, Prouff and Quisquater
-    // Section 3.2
-    // but with an optimization to multiply every element in the returned
-    // vector by |coeff|.
-
-    // First pass: compute [a₁, a₁ * a₂, ..., a₁ * a₂ * ... * aₙ]
-    std::vector<G> productions;
-    productions.reserve(groups.size() + 1);
-    productions.push_back(G::One());
-    G product = G::One();
-    for (const G& g : groups) {
-      if (!g.IsZero()) {
-        product *= g;
-        productions.push_back(product);
-      }
+  // Returns the memory to store the prefix products to. |inverses| is reused
+  // unless it's the same as |groups|.
+  static absl::Span<G> GetPrefixes(absl::Span<const G> groups,
+                                   absl::Span<G> inverses,
+                                   std::vector<G>* scratch) {
+    if (groups.data() != inverses.data()) return inverses;
+    if (scratch->size() < groups.size()) {
+      scratch->resize(groups.size());
     }
+    return absl::MakeSpan(scratch->data(), groups.size());
+  }
+
+  // Montgomery’s Trick and Fast Implementation of Masked AES
+  // Genelle, Prouff and Quisquater
+  // Section 3.2
+  // but with an optimization to multiply every element in the returned
+  // vector by |coeff|.
+  constexpr static void DoBatchInverse(absl::Span<const G> groups,
+                                       absl::Span<G> inverses,
+                                       absl::Span<G> prefixes,
+                                       const G& coeff) {
+    G product = ComputePrefixProducts(groups, prefixes);
 
     // Invert |product|.
     // (a₁ * a₂ * ... *  aₙ)⁻¹
@@ -189,18 +232,40 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
     // c * (a₁ * a₂ * ... *  aₙ)⁻¹
     product_inv *= coeff;
 
-    // Second pass: iterate backwards to compute inverses.
-    //              [c * a₁⁻¹, c * a₂,⁻¹ ..., c * aₙ⁻¹]
-    auto prod_it = productions.rbegin();
-    ++prod_it;
+    BackSubstitute(groups, inverses, prefixes, product_inv);
+  }
+
+  // Computes |prefixes[i]| = a₁ * a₂ * ... * aᵢ₋₁, skipping the zeros, and
+  // returns a₁ * a₂ * ... * aₙ.
+  constexpr static G ComputePrefixProducts(absl::Span<const G> groups,
+                                           absl::Span<G> prefixes) {
+    G product = G::One();
+    for (size_t i = 0; i < groups.size(); ++i) {
+      prefixes[i] = product;
+      if (!groups[i].IsZero()) {
+        product *= groups[i];
+      }
+    }
+    return product;
+  }
+
+  // Iterates backwards to compute the inverses from |coeff_product_inv| =
+  // c * (a₁ * a₂ * ... *  aₙ)⁻¹ and |prefixes|.
+  //   [c * a₁⁻¹, c * a₂,⁻¹ ..., c * aₙ⁻¹]
+  // |inverses| may be the same as either |groups| or |prefixes|, since each
+  // element is read before it's written.
+  constexpr static void BackSubstitute(absl::Span<const G> groups,
+                                       absl::Span<G> inverses,
+                                       absl::Span<const G> prefixes,
+                                       const G& coeff_product_inv) {
+    G product_inv = coeff_product_inv;
     for (size_t i = groups.size() - 1; i != std::numeric_limits<size_t>::max();
          --i) {
-      const G& g = groups[i];
-      if (!g.IsZero()) {
+      if (!groups[i].IsZero()) {
         // c * (a₁ * a₂ * ... *  aᵢ)⁻¹ * aᵢ = c * (a₁ * a₂ * ... *  aᵢ₋₁)⁻¹
-        G new_product_inv = product_inv * g;
+        G new_product_inv = product_inv * groups[i];
         // v = c * (a₁ * a₂ * ... *  aᵢ)⁻¹ * (a₁ * a₂ * ... aᵢ₋₁) = c * aᵢ⁻¹
-        inverses[i] = product_inv * (*(prod_it++));
+        inverses[i] = product_inv * prefixes[i];
         product_inv = std::move(new_product_inv);
       } else {
         inverses[i] = G::Zero();
@@ -96,27 +96,44 @@ TEST(GroupsTest, InverseOverride) {
 TEST(GroupsTest, BatchInverse) {
   math::GF7::Init();
 #if defined(TACHYON_HAS_OPENMP)
-  size_t size = size_t{1} << (static_cast<size_t>(omp_get_max_threads()) /
-                              GF7::kParallelBatchInverseDivisorThreshold);
+  size_t parallel_size = static_cast<size_t>(omp_get_max_threads()) *
+                             GF7::kMinParallelBatchInverseChunkSize +
+                         3;
 #else
-  size_t size = 5;
+  size_t parallel_size = 1000;
 #endif
-  // GF7 is MultiplicativeGroup because it satisfies the conditions of Field.
-  std::vector<GF7> groups =
-      base::CreateVector(size, []() { return GF7::Random(); });
-  std::vector<GF7> inverses;
-  inverses.resize(groups.size());
-  ASSERT_TRUE(GF7::BatchInverse(groups, &inverses));
-  for (size_t i = 0; i < groups.size(); ++i) {
-    if (groups[i].IsZero()) {
-      EXPECT_TRUE(inverses[i].IsZero());
-    } else {
-      EXPECT_TRUE((inverses[i] * groups[i]).IsOne());
+  std::vector<GF7> scratch;
+  for (size_t size : {size_t{0}, size_t{1}, size_t{5}, parallel_size}) {
+    // GF7 is MultiplicativeGroup because it satisfies the conditions of Field.
+    std::vector<GF7> groups =
+        base::CreateVector(size, []() { return GF7::Random(); });
+    if (size > 1) {
+      groups[size / 2] = GF7::Zero();
     }
-  }
+    GF7 coeff = GF7::Random();
+    std::vector<GF7> inverses;
+    inverses.resize(groups.size());
+    ASSERT_TRUE(GF7::BatchInverse(groups, &inverses, coeff));
+    for (size_t i = 0; i < groups.size(); ++i) {
+      if (groups[i].IsZero()) {
+        EXPECT_TRUE(inverses[i].IsZero());
+      } else {
+        EXPECT_EQ(inverses[i] * groups[i], coeff);
+      }
+    }
+
+    std::vector<GF7> inverses_serial;
+    inverses_serial.resize(groups.size());
+    ASSERT_TRUE(GF7::BatchInverseSerial(groups, &inverses_serial, coeff));
+    EXPECT_EQ(inverses_serial, inverses);
 
-  ASSERT_TRUE(GF7::BatchInverseInPlace(groups));
-  EXPECT_EQ(groups, inverses);
+    std::vector<GF7> groups_copy = groups;
+    ASSERT_TRUE(GF7::BatchInverseInPlace(groups_copy, &scratch, coeff));
+    EXPECT_EQ(groups_copy, inverses);
+
+    ASSERT_TRUE(GF7::BatchInverseInPlace(groups, coeff));
+    EXPECT_EQ(groups, inverses);
+  }
 }
 
 TEST(GroupsTest, Sub) {
@@ -0,0 +1,299 @@
+#ifndef TACHYON_MATH_BASE_SAFE_GCD_H_
+#define TACHYON_MATH_BASE_SAFE_GCD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "absl/numeric/int128.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// |SafeGcd<N>| computes modular inverses modulo an odd |modulus| with the
+// variable time variant of the Bernstein-Yang "safegcd" algorithm. It
+// processes 62 divsteps at once on the lowest limbs and applies the resulting
+// 2x2 transition matrix to the whole numbers, which avoids the data dependent
+// loops over the multi-limb numbers of the binary extended euclidean algorithm.
+//
+// The numbers are kept in the signed 62-bit limb representation, where every
+// limb is in [0, 2⁶²) except for the top one, which holds the sign.
+//
+// See https://gcd.cr.yp.to/safegcd-20190413.pdf and
+// https://github.com/bitcoin-core/secp256k1/blob/master/doc/safegcd_implementation.md
+template <size_t N>
+class SafeGcd {
+ public:
+  // The number of signed 62-bit limbs needed to hold a value in the range
+  // (-2 * |modulus|, |modulus|).
+  constexpr static size_t kLimbNums = (N * 64 + 2 + 61) / 62;
+
+  using Signed62 = std::array<int64_t, kLimbNums>;
+
+  constexpr explicit SafeGcd(const BigInt<N>& modulus)
+      : modulus_(ToSigned62(modulus)),
+        modulus_inv62_(ComputeInverse62(modulus[0])) {}
+
+  // Returns |a|⁻¹ * |b| mod |modulus|. |a| must not be zero and |b| must be
+  // less than |modulus|.
+  //
+  // NOTE: Passing R² as |b| for |a| in the montgomery form, i.e., aR, returns
+  // a⁻¹ in the montgomery form, i.e., a⁻¹R, since (aR)⁻¹ * R² = a⁻¹R.
+  BigInt<N> Inverse(const BigInt<N>& a, const BigInt<N>& b) const {
+    // See https://github.com/kroma-network/tachyon/issues/76
+    CHECK(!a.IsZero());
+
+    // Invariants: d * a ≡ b * f and e * a ≡ b * g (mod |modulus|).
+    Signed62 d = {};
+    Signed62 e = ToSigned62(b);
+    Signed62 f = modulus_;
+    Signed62 g = ToSigned62(a);
+    size_t len = kLimbNums;
+    // η = -δ, where δ is initially 1.
+    int64_t eta = -1;
+    while (true) {
+      Transition t;
+      eta = DivSteps62(eta, f[0], g[0], &t);
+      UpdateDE(t, &d, &e);
+      UpdateFG(t, len, &f, &g);
+
+      // If the lowest limb of g is zero, there is a chance that g = 0.
+      if (g[0] == 0) {
+        int64_t cond = 0;
+        for (size_t i = 1; i < len; ++i) {
+          cond |= g[i];
+        }
+        if (cond == 0) break;
+      }
+
+      // If the top limbs of both f and g are either 0 or -1, shrink the length
+      // by propagating their signs to the limbs below.
+      int64_t fn = f[len - 1];
+      int64_t gn = g[len - 1];
+      if (len > 1 && (fn ^ (fn >> 63)) == 0 && (gn ^ (gn >> 63)) == 0) {
+        f[len - 2] |= static_cast<int64_t>(static_cast<uint64_t>(fn) << 62);
+        g[len - 2] |= static_cast<int64_t>(static_cast<uint64_t>(gn) << 62);
+        --len;
+      }
+    }
+    // Now g = 0 and f = ±1, since gcd(a, |modulus|) = 1.
+    Normalize(f[len - 1], &d);
+    return FromSigned62(d);
+  }
+
+ private:
+  constexpr static uint64_t kMask62 = std::numeric_limits<uint64_t>::max() >> 2;
+
+  // A 2x2 transition matrix [[u, v], [q, r]] scaled by 2⁶².
+  struct Transition {
+    int64_t u;
+    int64_t v;
+    int64_t q;
+    int64_t r;
+  };
+
+  constexpr static Signed62 ToSigned62(const BigInt<N>& value) {
+    Signed62 ret = {};
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      size_t bit = i * 62;
+      size_t limb = bit / 64;
+      size_t shift = bit % 64;
+      uint64_t v = 0;
+      if (limb < N) {
+        v = value[limb] >> shift;
+        if (shift > 2 && limb + 1 < N) {
+          v |= value[limb + 1] << (64 - shift);
+        }
+      }
+      ret[i] = static_cast<int64_t>(v & kMask62);
+    }
+    return ret;
+  }
+
+  // |value| must be in [0, 2⁶⁴ᴺ).
+  constexpr static BigInt<N> FromSigned62(const Signed62& value) {
+    BigInt<N> ret;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      uint64_t v = static_cast<uint64_t>(value[i]);
+      size_t bit = i * 62;
+      size_t limb = bit / 64;
+      size_t shift = bit % 64;
+      if (limb < N) {
+        ret[limb] |= v << shift;
+        if (shift > 2 && limb + 1 < N) {
+          ret[limb + 1] |= v >> (64 - shift);
+        }
+      }
+    }
+    return ret;
+  }
+
+  // Returns |m|⁻¹ mod 2⁶² with the Newton's method, where |m| is odd.
+  constexpr static uint64_t ComputeInverse62(uint64_t m) {
+    // |m| * |m| ≡ 1 (mod 8) for any odd |m|, so |inv| is correct to 3 bits.
+    uint64_t inv = m;
+    // Each iteration doubles the number of correct bits: 3, 6, 12, 24, 48, 96.
+    for (size_t i = 0; i < 5; ++i) {
+      inv *= 2 - m * inv;
+    }
+    return inv & kMask62;
+  }
+
+  // Performs 62 divsteps on the lowest 62 bits of f and g, and returns the
+  // updated η. The transition matrix is stored in |t|.
+  static int64_t DivSteps62(int64_t eta, uint64_t f0, uint64_t g0,
+                            Transition* t) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    uint64_t f = f0, g = g0;
+    int i = 62;
+    while (true) {
+      // The sentinel bit limits the zeros to be counted up to |i|.
+      int zeros = base::bits::CountTrailingZeroBits(
+          g | (std::numeric_limits<uint64_t>::max() << i));
+      // The |zeros| divsteps at once just divide g by 2.
+      g >>= zeros;
+      u <<= zeros;
+      v <<= zeros;
+      eta -= zeros;
+      i -= zeros;
+      if (i == 0) break;
+      DCHECK_EQ(f & 1, uint64_t{1});
+      DCHECK_EQ(g & 1, uint64_t{1});
+
+      uint64_t m;
+      uint64_t w;
+      if (eta < 0) {
+        // If η is negative, negate it and replace (f, g) with (g, -f).
+        uint64_t tmp;
+        eta = -eta;
+        tmp = f;
+        f = g;
+        g = -tmp;
+        tmp = u;
+        u = q;
+        q = -tmp;
+        tmp = v;
+        v = r;
+        r = -tmp;
+        // Cancels out up to 6 bits of g. No more than |i| bits can be
+        // cancelled out, and no more than η + 1 bits either, since the sign
+        // of η flips again then.
+        int limit = std::min(static_cast<int>(eta) + 1, i);
+        m = (std::numeric_limits<uint64_t>::max() >> (64 - limit)) & 63;
+        w = (f * g * (f * f - 2)) & m;
+      } else {
+        // Cancels out up to 4 bits of g with a simpler formula, since η tends
+        // to be small here.
+        int limit = std::min(static_cast<int>(eta) + 1, i);
+        m = (std::numeric_limits<uint64_t>::max() >> (64 - limit)) & 15;
+        w = f + (((f + 1) & 4) << 1);
+        w = (-w * g) & m;
+      }
+      g += f * w;
+      q += u * w;
+      r += v * w;
+      DCHECK_EQ(g & m, uint64_t{0});
+    }
+    t->u = static_cast<int64_t>(u);
+    t->v = static_cast<int64_t>(v);
+    t->q = static_cast<int64_t>(q);
+    t->r = static_cast<int64_t>(r);
+    return eta;
+  }
+
+  // Computes (d, e) = t * (d, e) / 2⁶² mod |modulus|. Both the inputs and the
+  // outputs are in the range (-2 * |modulus|, |modulus|).
+  void UpdateDE(const Transition& t, Signed62* d, Signed62* e) const {
+    const int64_t sd = (*d)[kLimbNums - 1] >> 63;
+    const int64_t se = (*e)[kLimbNums - 1] >> 63;
+    // Adds |modulus| * (md, me) to make the result non-negative and the lowest
+    // 62 bits zero.
+    int64_t md = (t.u & sd) + (t.v & se);
+    int64_t me = (t.q & sd) + (t.r & se);
+    absl::int128 cd = absl::int128(t.u) * (*d)[0] + absl::int128(t.v) * (*e)[0];
+    absl::int128 ce = absl::int128(t.q) * (*d)[0] + absl::int128(t.r) * (*e)[0];
+    md -= static_cast<int64_t>(
+        (modulus_inv62_ * absl::Int128Low64(cd) + static_cast<uint64_t>(md)) &
+        kMask62);
+    me -= static_cast<int64_t>(
+        (modulus_inv62_ * absl::Int128Low64(ce) + static_cast<uint64_t>(me)) &
+        kMask62);
+    cd += absl::int128(modulus_[0]) * md;
+    ce += absl::int128(modulus_[0]) * me;
+    DCHECK_EQ(absl::Int128Low64(cd) & kMask62, uint64_t{0});
+    DCHECK_EQ(absl::Int128Low64(ce) & kMask62, uint64_t{0});
+    cd >>= 62;
+    ce >>= 62;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      cd += absl::int128(t.u) * (*d)[i] + absl::int128(t.v) * (*e)[i] +
+            absl::int128(modulus_[i]) * md;
+      ce += absl::int128(t.q) * (*d)[i] + absl::int128(t.r) * (*e)[i] +
+            absl::int128(modulus_[i]) * me;
+      (*d)[i - 1] = static_cast<int64_t>(absl::Int128Low64(cd) & kMask62);
+      (*e)[i - 1] = static_cast<int64_t>(absl::Int128Low64(ce) & kMask62);
+      cd >>= 62;
+      ce >>= 62;
+    }
+    (*d)[kLimbNums - 1] = static_cast<int64_t>(cd);
+    (*e)[kLimbNums - 1] = static_cast<int64_t>(ce);
+  }
+
+  // Computes (f, g) = t * (f, g) / 2⁶² on the lowest |len| limbs.
+  static void UpdateFG(const Transition& t, size_t len, Signed62* f,
+                       Signed62* g) {
+    absl::int128 cf = absl::int128(t.u) * (*f)[0] + absl::int128(t.v) * (*g)[0];
+    absl::int128 cg = absl::int128(t.q) * (*f)[0] + absl::int128(t.r) * (*g)[0];
+    cf >>= 62;
+    cg >>= 62;
+    for (size_t i = 1; i < len; ++i) {
+      cf += absl::int128(t.u) * (*f)[i] + absl::int128(t.v) * (*g)[i];
+      cg += absl::int128(t.q) * (*f)[i] + absl::int128(t.r) * (*g)[i];
+      (*f)[i - 1] = static_cast<int64_t>(absl::Int128Low64(cf) & kMask62);
+      (*g)[i - 1] = static_cast<int64_t>(absl::Int128Low64(cg) & kMask62);
+      cf >>= 62;
+      cg >>= 62;
+    }
+    (*f)[len - 1] = static_cast<int64_t>(cf);
+    (*g)[len - 1] = static_cast<int64_t>(cg);
+  }
+
+  // Brings |r| from the range (-2 * |modulus|, |modulus|) into
+  // [0, |modulus|), and negates it if |sign| is negative.
+  void Normalize(int64_t sign, Signed62* r) const {
+    int64_t cond_add = (*r)[kLimbNums - 1] >> 63;
+    int64_t cond_negate = sign >> 63;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      (*r)[i] += modulus_[i] & cond_add;
+      (*r)[i] = ((*r)[i] ^ cond_negate) - cond_negate;
+    }
+    Propagate(r);
+    // Now |r| is in the range (-|modulus|, |modulus|).
+    cond_add = (*r)[kLimbNums - 1] >> 63;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      (*r)[i] += modulus_[i] & cond_add;
+    }
+    Propagate(r);
+  }
+
+  // Brings the limbs back to [0, 2⁶²) except for the top one.
+  static void Propagate(Signed62* r) {
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      (*r)[i + 1] += (*r)[i] >> 62;
+      (*r)[i] &= static_cast<int64_t>(kMask62);
+    }
+  }
+
+  Signed62 modulus_;
+  // |modulus|⁻¹ mod 2⁶²
+  uint64_t modulus_inv62_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_BASE_SAFE_GCD_H_
@@ -0,0 +1,61 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/base/safe_gcd.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+
+namespace tachyon::math {
+
+template <typename F>
+std::vector<typename F::BigIntTy> PrepareTestSet(size_t size) {
+  return base::CreateVector(size, []() { return F::Random().value(); });
+}
+
+template <typename F>
+void BM_MontgomeryInverse(benchmark::State& state) {
+  using BigIntTy = typename F::BigIntTy;
+  using Config = typename F::Config;
+
+  size_t size = state.range(0);
+  std::vector<BigIntTy> test_set = PrepareTestSet<F>(size);
+  BigIntTy ret;
+  size_t i = 0;
+  for (auto _ : state) {
+    ret = test_set[(i++) % size]
+              .template MontgomeryInverse<Config::kModulusHasSpareBit>(
+                  Config::kModulus, Config::kMontgomeryR2);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename F>
+void BM_SafeGcdInverse(benchmark::State& state) {
+  using BigIntTy = typename F::BigIntTy;
+  using Config = typename F::Config;
+
+  size_t size = state.range(0);
+  std::vector<BigIntTy> test_set = PrepareTestSet<F>(size);
+  SafeGcd<F::N> safe_gcd(Config::kModulus);
+  BigIntTy ret;
+  size_t i = 0;
+  for (auto _ : state) {
+    ret = safe_gcd.Inverse(test_set[(i++) % size], Config::kMontgomeryR2);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+BENCHMARK_TEMPLATE(BM_MontgomeryInverse, bn254::Fq)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_SafeGcdInverse, bn254::Fq)->Arg(1000);
+
+}  // namespace tachyon::math
+
+// clang-format off
+// Executing tests from //tachyon/math/base:safe_gcd_benchmark
+// -------------------------------------------------------------------------------
+// Benchmark                                     Time             CPU   Iterations
+// -------------------------------------------------------------------------------
+// BM_MontgomeryInverse<bn254::Fq>/1000      12711 ns        12514 ns        52267
+// BM_SafeGcdInverse<bn254::Fq>/1000          1864 ns         1805 ns       310781
+// clang-format on
@@ -0,0 +1,79 @@
+#include "tachyon/math/base/safe_gcd.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/base/gmp/gmp_util.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <size_t N>
+mpz_class ToMpzClass(const BigInt<N>& value) {
+  mpz_class ret;
+  gmp::WriteLimbs(value.limbs, N, &ret);
+  return ret;
+}
+
+template <size_t N>
+void TestInverse(const BigInt<N>& modulus) {
+  SafeGcd<N> safe_gcd(modulus);
+  mpz_class m = ToMpzClass(modulus);
+  for (size_t i = 0; i < 100; ++i) {
+    BigInt<N> a = BigInt<N>::Random(modulus);
+    if (a.IsZero()) continue;
+    BigInt<N> b = BigInt<N>::Random(modulus);
+    mpz_class expected;
+    mpz_invert(expected.get_mpz_t(), ToMpzClass(a).get_mpz_t(),
+               m.get_mpz_t());
+    expected = expected * ToMpzClass(b) % m;
+    EXPECT_EQ(ToMpzClass(safe_gcd.Inverse(a, b)), expected);
+  }
+  // Edge cases.
+  BigInt<N> one = BigInt<N>::One();
+  EXPECT_EQ(safe_gcd.Inverse(one, one), one);
+  BigInt<N> minus_one = modulus;
+  minus_one -= one;
+  EXPECT_EQ(safe_gcd.Inverse(minus_one, one), minus_one);
+  EXPECT_EQ(safe_gcd.Inverse(minus_one, minus_one), one);
+}
+
+}  // namespace
+
+TEST(SafeGcdTest, Inverse) {
+  // GF(7)
+  TestInverse(BigInt<1>(7));
+  // Goldilocks
+  TestInverse(BigInt<1>(UINT64_C(18446744069414584321)));
+  // bn254 Fr
+  TestInverse(BigInt<4>::FromDecString(
+      "2188824287183927522224640574525727508854836440041603434369820418657580"
+      "8495617"));
+  // bn254 Fq
+  TestInverse(BigInt<4>::FromDecString(
+      "2188824287183927522224640574525727508869631115729782366268903789464522"
+      "6208583"));
+  // bls12-381 Fq
+  TestInverse(BigInt<6>::FromHexString(
+      "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffe"
+      "b153ffffb9feffffffffaaab"));
+}
+
+TEST(SafeGcdTest, MontgomeryInverse) {
+  // bn254 Fq
+  BigInt<4> modulus = BigInt<4>::FromDecString(
+      "2188824287183927522224640574525727508869631115729782366268903789464522"
+      "6208583");
+  // R² mod p, where R = 2²⁵⁶
+  BigInt<4> r2 = BigInt<4>::FromHexString(
+      "06d89f71cab8351f47ab1eff0a417ff6b5e71911d44501fbf32cfc5b538afa89");
+  SafeGcd<4> safe_gcd(modulus);
+  for (size_t i = 0; i < 100; ++i) {
+    BigInt<4> a = BigInt<4>::Random(modulus);
+    if (a.IsZero()) continue;
+    EXPECT_EQ(safe_gcd.Inverse(a, r2),
+              a.MontgomeryInverse<true>(modulus, r2));
+  }
+}
+
+}  // namespace tachyon::math
@@ -110,6 +110,72 @@ class Pippenger : public PippengerBase<PointTy> {
     return true;
   }
 
+  // Runs the MSM of the same bases with each of |scalars_vec|, and populates
+  // |rets| with the results. Each scalars may be shorter than the bases, in
+  // which case only the first bases are used. The windows are sized once for
+  // all of them, and the pairs of a window and scalars are processed in
+  // parallel in window-major order if |parallel_windows_| is set, so that the
+  // threads working on the same window read the same bases at about the same
+  // time. Window NAF isn't used here, because the signed digits of every
+  // scalars would have to be kept in memory at once.
+  template <typename BaseInputIterator>
+  bool RunBatch(BaseInputIterator bases_first, BaseInputIterator bases_last,
+                absl::Span<const absl::Span<const ScalarField>> scalars_vec,
+                std::vector<Bucket>* rets) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = 0;
+    for (absl::Span<const ScalarField> scalars : scalars_vec) {
+      if (scalars.size() > bases_size) {
+        LOG(ERROR) << "scalars_size exceeds bases_size";
+        return false;
+      }
+      scalars_size = std::max(scalars_size, scalars.size());
+    }
+    ctx_ = PippengerCtx::CreateDefault<ScalarField>(scalars_size);
+
+    size_t batch_size = scalars_vec.size();
+    std::vector<std::vector<BigInt<N>>> scalars_bigints(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+      absl::Span<const ScalarField> scalars = scalars_vec[i];
+      std::vector<BigInt<N>>& bigints = scalars_bigints[i];
+      bigints.resize(scalars.size());
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < scalars.size(); ++j) {
+        bigints[j] = scalars[j].ToBigInt();
+      }
+    }
+
+    std::vector<Bucket> window_sums =
+        base::CreateVector(batch_size * ctx_.window_count, Bucket::Zero());
+    size_t num_tasks = ctx_.window_count * batch_size;
+    auto accumulate = [this, bases_first, batch_size, &scalars_bigints,
+                       &window_sums](size_t i) {
+      size_t window = i / batch_size;
+      size_t batch_idx = i % batch_size;
+      AccumulateSingleWindowSum(
+          bases_first, absl::MakeConstSpan(scalars_bigints[batch_idx]),
+          ctx_.window_bits * window,
+          &window_sums[batch_idx * ctx_.window_count + window]);
+    };
+    if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_tasks; ++i) {
+        accumulate(i);
+      }
+    } else {
+      for (size_t i = 0; i < num_tasks; ++i) {
+        accumulate(i);
+      }
+    }
+
+    rets->resize(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+      (*rets)[i] = PippengerBase<PointTy>::AccumulateWindowSums(
+          absl::MakeConstSpan(window_sums)
+              .subspan(i * ctx_.window_count, ctx_.window_count),
+          ctx_.window_bits);
+    }
+    return true;
+  }
+
  private:
   template <typename BaseInputIterator>
   void AccumulateSingleWindowNAFSum(
@@ -68,4 +68,43 @@ TYPED_TEST(PippengerTest, Run) {
   }
 }
 
+TYPED_TEST(PippengerTest, RunBatch) {
+  using PointTy = TypeParam;
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  // The second scalars are shorter than the bases.
+  std::vector<ScalarField> scalars =
+      base::CreateVector(kSize / 2, []() { return ScalarField::Random(); });
+  Bucket expected;
+  {
+    Pippenger<PointTy> pippenger;
+    ASSERT_TRUE(pippenger.Run(test_set.bases.begin(),
+                              test_set.bases.begin() + scalars.size(),
+                              scalars.begin(), scalars.end(), &expected));
+  }
+
+  std::vector<absl::Span<const ScalarField>> scalars_vec = {
+      absl::MakeConstSpan(test_set.scalars), absl::MakeConstSpan(scalars)};
+  Pippenger<PointTy> pippenger;
+  std::vector<Bucket> rets;
+  for (bool parallel_windows : {false, true}) {
+    SCOPED_TRACE(absl::Substitute("parallel_windows: $0", parallel_windows));
+    pippenger.SetParallelWindows(parallel_windows);
+    ASSERT_TRUE(pippenger.RunBatch(test_set.bases.begin(),
+                                   test_set.bases.end(),
+                                   absl::MakeConstSpan(scalars_vec), &rets));
+    ASSERT_EQ(rets.size(), size_t{2});
+    EXPECT_EQ(rets[0], test_set.answer);
+    EXPECT_EQ(rets[1], expected);
+  }
+
+  // Scalars longer than the bases are rejected.
+  ASSERT_FALSE(pippenger.RunBatch(test_set.bases.begin(),
+                                  test_set.bases.begin() + scalars.size() - 1,
+                                  absl::MakeConstSpan(scalars_vec), &rets));
+}
+
 }  // namespace tachyon::math
@@ -2,6 +2,9 @@
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
 
@@ -33,6 +36,17 @@ class VariableBaseMSM {
     return Run(std::begin(bases), std::end(bases), std::begin(scalars),
                std::end(scalars), ret);
   }
+
+  // Runs the MSM of |bases| with each of |scalars_vec| in a single pass. See
+  // |Pippenger::RunBatch()|.
+  template <typename BaseContainer>
+  bool RunBatch(const BaseContainer& bases,
+                absl::Span<const absl::Span<const ScalarField>> scalars_vec,
+                std::vector<Bucket>* rets) {
+    Pippenger<PointTy> pippenger;
+    return pippenger.RunBatch(std::begin(bases), std::end(bases), scalars_vec,
+                              rets);
+  }
 };
 
 }  // namespace tachyon::math
@@ -7,8 +7,10 @@
 #include <ostream>
 #include <string>
 
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/base/safe_gcd.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
 extern "C" void Fec_rawAdd(uint64_t result[4], const uint64_t a[4],
@@ -205,12 +207,19 @@ class PrimeField<_Config, std::enable_if_t<_Config::kIsSecp256k1Fq>> final
   }
 
   constexpr PrimeField& InverseInPlace() {
-    value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
-        Config::kModulus, Config::kMontgomeryR2);
+    if (base::is_constant_evaluated()) {
+      value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
+          Config::kModulus, Config::kMontgomeryR2);
+    } else {
+      value_ = kSafeGcd.Inverse(value_, Config::kMontgomeryR2);
+    }
     return *this;
   }
 
  private:
+  // Used to compute the inverse at runtime. See |InverseInPlace()|.
+  constexpr static SafeGcd<N> kSafeGcd = SafeGcd<N>(Config::kModulus);
+
   BigInt<N> value_;
 };
 
@@ -5,10 +5,13 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/substitute.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/groups.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/curve_type.h"
@@ -70,6 +73,32 @@ class AffinePoint<
     return point;
   }
 
+  // Batch version of |CreateFromX()|. Populates |points| with the points whose
+  // x-coordinates are |xs|, choosing the odd y-coordinate if |pick_odds[i]| is
+  // set. The square roots are computed in batch. See
+  // |FiniteField::BatchSquareRoot()|. Returns false if any of |xs| doesn't
+  // correspond to a curve point.
+  static bool BatchCreateFromX(absl::Span<const BaseField> xs,
+                               const std::vector<bool>& pick_odds,
+                               absl::Span<AffinePoint> points) {
+    if (xs.size() != pick_odds.size() || xs.size() != points.size()) {
+      LOG(ERROR) << "Size of |xs|, |pick_odds| and |points| do not match";
+      return false;
+    }
+    std::vector<BaseField> ys(xs.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < xs.size(); ++i) {
+      ys[i] = Curve::ComputeRightHandSide(xs[i]);
+    }
+    if (!BaseField::BatchSquareRoot(ys, absl::MakeSpan(ys))) return false;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < xs.size(); ++i) {
+      if (ys[i].ToBigInt().IsOdd() != pick_odds[i]) {
+        ys[i].NegInPlace();
+      }
+      points[i] = AffinePoint(xs[i], std::move(ys[i]));
+    }
+    return true;
+  }
+
   constexpr static AffinePoint Zero() { return AffinePoint(); }
 
   constexpr static AffinePoint Generator() {
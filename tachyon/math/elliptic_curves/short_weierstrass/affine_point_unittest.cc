@@ -1,5 +1,7 @@
 #include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/short_weierstrass/jacobian_point.h"
@@ -141,4 +143,21 @@ TEST_F(AffinePointTest, CreateFromX) {
   }
 }
 
+TEST_F(AffinePointTest, BatchCreateFromX) {
+  std::vector<GF7> xs = {GF7(3), GF7(3), GF7(5)};
+  std::vector<bool> pick_odds = {true, false, true};
+  std::vector<test::AffinePoint> points(xs.size());
+  ASSERT_TRUE(test::AffinePoint::BatchCreateFromX(xs, pick_odds,
+                                                  absl::MakeSpan(points)));
+  for (size_t i = 0; i < xs.size(); ++i) {
+    EXPECT_EQ(points[i], *test::AffinePoint::CreateFromX(xs[i], pick_odds[i]));
+  }
+
+  xs.push_back(GF7(1));
+  pick_odds.push_back(false);
+  points.resize(xs.size());
+  EXPECT_FALSE(test::AffinePoint::BatchCreateFromX(xs, pick_odds,
+                                                   absl::MakeSpan(points)));
+}
+
 }  // namespace tachyon::math
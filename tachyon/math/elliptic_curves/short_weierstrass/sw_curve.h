@@ -64,12 +64,8 @@ class SWCurve {
   // corresponds to a curve point. Otherwise, returns false.
   constexpr static bool GetYsFromX(const BaseField& x, BaseField* even_y,
                                    BaseField* odd_y) {
-    BaseField right = x.Square() * x + Config::kB;
-    if constexpr (!Config::kAIsZero) {
-      right += Config::kA * x;
-    }
     BaseField y;
-    if (!right.SquareRoot(&y)) return false;
+    if (!ComputeRightHandSide(x).SquareRoot(&y)) return false;
 
     if (y.ToBigInt().IsEven()) {
       *odd_y = -y;
@@ -81,13 +77,19 @@ class SWCurve {
     return true;
   }
 
-  constexpr static bool IsOnCurve(const AffinePointTy& point) {
-    if (point.infinity()) return false;
-    BaseField right = point.x().Square() * point.x() + Config::kB;
+  // Returns x³ + a * x + b, which is y² of the points whose x-coordinate is
+  // |x|.
+  constexpr static BaseField ComputeRightHandSide(const BaseField& x) {
+    BaseField right = x.Square() * x + Config::kB;
     if constexpr (!Config::kAIsZero) {
-      right += Config::kA * point.x();
+      right += Config::kA * x;
     }
-    return point.y().Square() == right;
+    return right;
+  }
+
+  constexpr static bool IsOnCurve(const AffinePointTy& point) {
+    if (point.infinity()) return false;
+    return point.y().Square() == ComputeRightHandSide(point.x());
   }
 
   constexpr static bool IsOnCurve(const ProjectivePointTy& point) {
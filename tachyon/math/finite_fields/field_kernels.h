@@ -0,0 +1,86 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_FIELD_KERNELS_H_
+#define TACHYON_MATH_FINITE_FIELDS_FIELD_KERNELS_H_
+
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks_avx2.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks_avx512.h"
+#include "tachyon/math/finite_fields/packed_prime_field31_avx2.h"
+#include "tachyon/math/finite_fields/packed_prime_field31_avx512.h"
+#include "tachyon/math/finite_fields/packed_prime_field_avx512.h"
+
+namespace tachyon::math {
+
+// |FieldKernels<F>| is a table of the batch kernels of |F|. Each entry is
+// resolved once, at the first |Get()|, to the widest SIMD implementation that
+// the running CPU supports (see |base::CpuFeatures|), or is null if there is
+// none, in which case the caller falls back to its scalar loop. This lets a
+// single binary use the best kernels on every host.
+template <typename F>
+struct FieldKernels {
+  // |a[i]| *= |b[i]|
+  void (*batch_mul_in_place)(absl::Span<F> a, absl::Span<const F> b) = nullptr;
+  // |a[i]| *= |c| * |g|ⁱ
+  void (*batch_distribute_powers)(absl::Span<F> a, const F& c,
+                                  const F& g) = nullptr;
+  // See |UnivariateEvaluationDomain<F>::ButterflyFnInOut()|.
+  void (*batch_butterfly_in_out)(absl::Span<F> lo, absl::Span<F> hi,
+                                 const F* roots, size_t step) = nullptr;
+  // See |UnivariateEvaluationDomain<F>::ButterflyFnOutIn()|.
+  void (*batch_butterfly_out_in)(absl::Span<F> lo, absl::Span<F> hi,
+                                 const F* roots, size_t step) = nullptr;
+
+  static const FieldKernels& Get() {
+    static const FieldKernels kernels = Resolve();
+    return kernels;
+  }
+
+ private:
+  static FieldKernels Resolve() {
+    FieldKernels kernels;
+    if constexpr (kCanUsePackedPrimeFieldAvx512<F>) {
+      using PackedF = PackedPrimeFieldAvx512<F>;
+      if (PackedF::IsAvailable()) {
+        kernels.batch_mul_in_place = &PackedF::BatchMulInPlace;
+        kernels.batch_distribute_powers = &PackedF::BatchDistributePowers;
+        kernels.batch_butterfly_in_out = &PackedF::BatchButterflyInOut;
+        kernels.batch_butterfly_out_in = &PackedF::BatchButterflyOutIn;
+        return kernels;
+      }
+    }
+    if constexpr (kCanUsePackedPrimeField31Avx512<F>) {
+      if (PackedPrimeField31Avx512<F>::IsAvailable()) {
+        kernels.batch_mul_in_place =
+            &PackedPrimeField31Avx512<F>::BatchMulInPlace;
+        return kernels;
+      }
+    }
+    if constexpr (kCanUsePackedPrimeField31Avx2<F>) {
+      if (PackedPrimeField31Avx2<F>::IsAvailable()) {
+        kernels.batch_mul_in_place =
+            &PackedPrimeField31Avx2<F>::BatchMulInPlace;
+        return kernels;
+      }
+    }
+    if constexpr (kCanUsePackedGoldilocksAvx512<F>) {
+      if (PackedGoldilocksAvx512<F>::IsAvailable()) {
+        kernels.batch_mul_in_place =
+            &PackedGoldilocksAvx512<F>::BatchMulInPlace;
+        return kernels;
+      }
+    }
+    if constexpr (kCanUsePackedGoldilocksAvx2<F>) {
+      if (PackedGoldilocksAvx2<F>::IsAvailable()) {
+        kernels.batch_mul_in_place = &PackedGoldilocksAvx2<F>::BatchMulInPlace;
+        return kernels;
+      }
+    }
+    return kernels;
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_FIELD_KERNELS_H_
@@ -0,0 +1,111 @@
+#include "tachyon/math/finite_fields/field_kernels.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/mersenne31.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename F>
+class FieldKernelsTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+}  // namespace
+
+using FieldTypes = testing::Types<BabyBear, Mersenne31, bn254::Fr>;
+TYPED_TEST_SUITE(FieldKernelsTest, FieldTypes);
+
+TYPED_TEST(FieldKernelsTest, BatchMulInPlace) {
+  using F = TypeParam;
+
+  auto batch_mul_in_place = FieldKernels<F>::Get().batch_mul_in_place;
+  if (!batch_mul_in_place) {
+    GTEST_SKIP() << "No SIMD kernel is available";
+  }
+  for (size_t size : {size_t{0}, size_t{7}, size_t{64}, size_t{101}}) {
+    std::vector<F> a = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> b = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> expected = base::CreateVector(
+        size, [&a, &b](size_t i) { return a[i] * b[i]; });
+    batch_mul_in_place(absl::MakeSpan(a), b);
+    EXPECT_EQ(a, expected);
+  }
+}
+
+TYPED_TEST(FieldKernelsTest, BatchDistributePowers) {
+  using F = TypeParam;
+
+  auto batch_distribute_powers =
+      FieldKernels<F>::Get().batch_distribute_powers;
+  if (!batch_distribute_powers) {
+    GTEST_SKIP() << "No SIMD kernel is available";
+  }
+  F c = F::Random();
+  F g = F::Random();
+  std::vector<F> a = base::CreateVector(37, []() { return F::Random(); });
+  std::vector<F> expected = a;
+  F pow = c;
+  for (F& value : expected) {
+    value *= pow;
+    pow *= g;
+  }
+  batch_distribute_powers(absl::MakeSpan(a), c, g);
+  EXPECT_EQ(a, expected);
+}
+
+TYPED_TEST(FieldKernelsTest, BatchButterfly) {
+  using F = TypeParam;
+
+  const FieldKernels<F>& kernels = FieldKernels<F>::Get();
+  if (!kernels.batch_butterfly_in_out || !kernels.batch_butterfly_out_in) {
+    GTEST_SKIP() << "No SIMD kernel is available";
+  }
+  constexpr size_t kSize = 37;
+  constexpr size_t kStep = 2;
+  std::vector<F> roots =
+      base::CreateVector(kSize * kStep, []() { return F::Random(); });
+  std::vector<F> lo = base::CreateVector(kSize, []() { return F::Random(); });
+  std::vector<F> hi = base::CreateVector(kSize, []() { return F::Random(); });
+
+  std::vector<F> expected_lo = lo;
+  std::vector<F> expected_hi = hi;
+  for (size_t i = 0; i < kSize; ++i) {
+    F neg = expected_lo[i] - expected_hi[i];
+    expected_lo[i] += expected_hi[i];
+    expected_hi[i] = neg * roots[i * kStep];
+  }
+  std::vector<F> actual_lo = lo;
+  std::vector<F> actual_hi = hi;
+  kernels.batch_butterfly_in_out(absl::MakeSpan(actual_lo),
+                                 absl::MakeSpan(actual_hi), roots.data(),
+                                 kStep);
+  EXPECT_EQ(actual_lo, expected_lo);
+  EXPECT_EQ(actual_hi, expected_hi);
+
+  expected_lo = lo;
+  expected_hi = hi;
+  for (size_t i = 0; i < kSize; ++i) {
+    expected_hi[i] *= roots[i * kStep];
+    F neg = expected_lo[i] - expected_hi[i];
+    expected_lo[i] += expected_hi[i];
+    expected_hi[i] = neg;
+  }
+  actual_lo = lo;
+  actual_hi = hi;
+  kernels.batch_butterfly_out_in(absl::MakeSpan(actual_lo),
+                                 absl::MakeSpan(actual_hi), roots.data(),
+                                 kStep);
+  EXPECT_EQ(actual_lo, expected_lo);
+  EXPECT_EQ(actual_hi, expected_hi);
+}
+
+}  // namespace tachyon::math
@@ -1,8 +1,11 @@
 #ifndef TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 #define TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 
+#include "absl/types/span.h"
+
 #include "tachyon/math/base/field.h"
 #include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/batch_square_root.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/shanks.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/tonelli_shanks.h"
 
@@ -31,6 +34,12 @@ class FiniteField : public Field<F> {
     }
     return false;
   }
+
+  // Computes the square roots of |values| to |roots| in parallel. Returns
+  // false if any of |values| doesn't have a square root.
+  static bool BatchSquareRoot(absl::Span<const F> values, absl::Span<F> roots) {
+    return ComputeBatchSquareRoot(values, roots);
+  }
 };
 
 }  // namespace tachyon::math
@@ -1,5 +1,8 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 
@@ -40,4 +43,35 @@ TYPED_TEST(FiniteFieldTest, SquareRoot) {
   EXPECT_TRUE(success);
 }
 
+TYPED_TEST(FiniteFieldTest, BatchSquareRoot) {
+  using F = TypeParam;
+
+  std::vector<F> values = base::CreateVector(100, []() {
+    F f = F::Random();
+    return f.Square();
+  });
+  values[0] = F::Zero();
+  std::vector<F> roots(values.size());
+  ASSERT_TRUE(F::BatchSquareRoot(values, absl::MakeSpan(roots)));
+  for (size_t i = 0; i < values.size(); ++i) {
+    F expected;
+    ASSERT_TRUE(values[i].SquareRoot(&expected));
+    EXPECT_EQ(roots[i].Square(), values[i]);
+    EXPECT_TRUE(roots[i] == expected || roots[i] == -expected);
+  }
+
+  // In place.
+  ASSERT_TRUE(F::BatchSquareRoot(values, absl::MakeSpan(values)));
+  EXPECT_EQ(values, roots);
+
+  // A quadratic non-residue.
+  F f = F::Random();
+  while (f.Legendre() != LegendreSymbol::kMinusOne) {
+    f = F::Random();
+  }
+  values = {F::One(), f};
+  roots.resize(values.size());
+  EXPECT_FALSE(F::BatchSquareRoot(values, absl::MakeSpan(roots)));
+}
+
 }  // namespace tachyon::math
@@ -19,6 +19,21 @@ TEST_F(Fp2Test, TypeTest) {
   EXPECT_TRUE((std::is_same_v<bn254::Fq2::BasePrimeField, bn254::Fq>));
 }
 
+TEST_F(Fp2Test, Mul) {
+  using F = bn254::Fq2;
+  using BaseField = bn254::Fq;
+
+  for (size_t i = 0; i < 100; ++i) {
+    F a = F::Random();
+    F b = F::Random();
+    // (a0 + a1 * u) * (b0 + b1 * u)
+    //   = (a0 * b0 - a1 * b1) + (a0 * b1 + a1 * b0) * u, where u² = -1.
+    BaseField c0 = a.c0() * b.c0() - a.c1() * b.c1();
+    BaseField c1 = a.c0() * b.c1() + a.c1() * b.c0();
+    EXPECT_EQ(a * b, F(c0, c1));
+  }
+}
+
 TEST_F(Fp2Test, Copyable) {
   using F = bn254::Fq2;
 
@@ -0,0 +1,249 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_AVX2_H_
+#define TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_AVX2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/prime_field_goldilocks_native.h"
+
+#if ARCH_CPU_X86_64 && defined(COMPILER_GCC) && !defined(__CUDA_ARCH__)
+#define TACHYON_HAS_PACKED_GOLDILOCKS_AVX2 1
+#include "tachyon/base/cpu_features.h"
+#include "tachyon/base/x86_intrinsics.h"
+#endif
+
+namespace tachyon::math {
+
+// |PackedGoldilocksAvx2<F>| holds 4 elements of the native Goldilocks field
+// |F| and operates on all of them at once with AVX2.
+template <typename F, typename SFINAE = void>
+class PackedGoldilocksAvx2;
+
+// True if |PackedGoldilocksAvx2<F>| is defined. Whether it can be used on the
+// current CPU should be checked by |PackedGoldilocksAvx2<F>::IsAvailable()| at
+// runtime.
+template <typename F, typename SFINAE = void>
+constexpr bool kCanUsePackedGoldilocksAvx2 = false;
+
+#if defined(TACHYON_HAS_PACKED_GOLDILOCKS_AVX2)
+
+template <typename Config>
+constexpr bool kCanUsePackedGoldilocksAvx2<
+    PrimeField<Config>, std::enable_if_t<Config::kIsNativeGoldilocks>> = true;
+
+namespace internal::goldilocks::avx2 {
+
+// True if the CPU supports AVX2. This is evaluated once at startup.
+inline const bool kHasAvx2 = base::HasCpuFeature(base::CpuFeature::kAvx2);
+
+constexpr size_t kWidth = 4;
+
+// AVX2 only has a signed 64-bit comparison, so both operands are offset by
+// 2⁶³ to compare them as unsigned. Returns all ones in the lanes where
+// |a| < |b|.
+TACHYON_AVX2_INLINE __m256i CmpLt(__m256i a, __m256i b) {
+  const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+  return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign),
+                            _mm256_xor_si256(a, sign));
+}
+
+TACHYON_AVX2_INLINE __m256i Canonicalize(__m256i a) {
+  const __m256i epsilon = _mm256_set1_epi64x(kEpsilon);
+  // |a| - p wraps around to a value greater than |a| if and only if |a| < p.
+  __m256i t = _mm256_add_epi64(a, epsilon);
+  return _mm256_blendv_epi8(a, t, CmpLt(t, a));
+}
+
+TACHYON_AVX2_INLINE __m256i Add(__m256i a, __m256i b) {
+  const __m256i epsilon = _mm256_set1_epi64x(kEpsilon);
+  __m256i sum = _mm256_add_epi64(a, b);
+  __m256i carry = CmpLt(sum, a);
+  sum = _mm256_add_epi64(sum, _mm256_and_si256(carry, epsilon));
+  return Canonicalize(sum);
+}
+
+TACHYON_AVX2_INLINE __m256i Sub(__m256i a, __m256i b) {
+  const __m256i epsilon = _mm256_set1_epi64x(kEpsilon);
+  __m256i diff = _mm256_sub_epi64(a, b);
+  __m256i borrow = CmpLt(a, b);
+  return _mm256_sub_epi64(diff, _mm256_and_si256(borrow, epsilon));
+}
+
+// See |internal::goldilocks::Reduce128()|.
+TACHYON_AVX2_INLINE __m256i Reduce128(__m256i hi, __m256i lo) {
+  const __m256i epsilon = _mm256_set1_epi64x(kEpsilon);
+  __m256i hi_hi = _mm256_srli_epi64(hi, 32);
+  __m256i hi_lo = _mm256_and_si256(hi, epsilon);
+
+  __m256i t0 = _mm256_sub_epi64(lo, hi_hi);
+  t0 = _mm256_sub_epi64(t0, _mm256_and_si256(CmpLt(lo, hi_hi), epsilon));
+  __m256i t1 = _mm256_sub_epi64(_mm256_slli_epi64(hi_lo, 32), hi_lo);
+  __m256i t2 = _mm256_add_epi64(t0, t1);
+  t2 = _mm256_add_epi64(t2, _mm256_and_si256(CmpLt(t2, t1), epsilon));
+  return Canonicalize(t2);
+}
+
+// Computes the 128-bit products of |a| and |b| from 4 32-bit products.
+TACHYON_AVX2_INLINE __m256i Mul(__m256i a, __m256i b) {
+  const __m256i mask32 = _mm256_set1_epi64x(kEpsilon);
+  __m256i a_hi = _mm256_srli_epi64(a, 32);
+  __m256i b_hi = _mm256_srli_epi64(b, 32);
+  __m256i ll = _mm256_mul_epu32(a, b);
+  __m256i lh = _mm256_mul_epu32(a, b_hi);
+  __m256i hl = _mm256_mul_epu32(a_hi, b);
+  __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+
+  __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+  __m256i u = _mm256_add_epi64(lh, _mm256_and_si256(t, mask32));
+  __m256i lo = _mm256_or_si256(_mm256_slli_epi64(u, 32),
+                               _mm256_and_si256(ll, mask32));
+  __m256i hi = _mm256_add_epi64(
+      hh, _mm256_add_epi64(_mm256_srli_epi64(t, 32), _mm256_srli_epi64(u, 32)));
+  return Reduce128(hi, lo);
+}
+
+}  // namespace internal::goldilocks::avx2
+
+// All the methods require AVX2, so they must not be called unless
+// |IsAvailable()| returns true.
+template <typename Config>
+class PackedGoldilocksAvx2<PrimeField<Config>,
+                           std::enable_if_t<Config::kIsNativeGoldilocks>>
+    final {
+ public:
+  using F = PrimeField<Config>;
+
+  constexpr static size_t kWidth = internal::goldilocks::avx2::kWidth;
+
+  static_assert(sizeof(F) == sizeof(uint64_t));
+
+  PackedGoldilocksAvx2() = default;
+
+  static bool IsAvailable() { return internal::goldilocks::avx2::kHasAvx2; }
+
+  static PackedGoldilocksAvx2 Zero() { return PackedGoldilocksAvx2(); }
+
+  static PackedGoldilocksAvx2 Broadcast(const F& value) {
+    PackedGoldilocksAvx2 ret;
+    std::fill(std::begin(ret.values_), std::end(ret.values_), value[0]);
+    return ret;
+  }
+
+  // Loads |values[0]|, ..., |values[3]|.
+  static PackedGoldilocksAvx2 Load(const F* values) {
+    PackedGoldilocksAvx2 ret;
+    std::copy_n(ToValues(values), kWidth, ret.values_);
+    return ret;
+  }
+
+  // Stores the elements to |values[0]|, ..., |values[3]|.
+  void Store(F* values) const {
+    std::copy_n(values_, kWidth, ToValues(values));
+  }
+
+  F operator[](size_t i) const {
+    DCHECK_LT(i, kWidth);
+    return F(values_[i]);
+  }
+
+  bool operator==(const PackedGoldilocksAvx2& other) const {
+    return std::equal(std::begin(values_), std::end(values_),
+                      std::begin(other.values_));
+  }
+  bool operator!=(const PackedGoldilocksAvx2& other) const {
+    return !operator==(other);
+  }
+
+  TACHYON_AVX2_TARGET PackedGoldilocksAvx2
+  operator+(const PackedGoldilocksAvx2& other) const {
+    return FromVector(
+        internal::goldilocks::avx2::Add(ToVector(), other.ToVector()));
+  }
+
+  TACHYON_AVX2_TARGET PackedGoldilocksAvx2
+  operator-(const PackedGoldilocksAvx2& other) const {
+    return FromVector(
+        internal::goldilocks::avx2::Sub(ToVector(), other.ToVector()));
+  }
+
+  TACHYON_AVX2_TARGET PackedGoldilocksAvx2 operator-() const {
+    return FromVector(internal::goldilocks::avx2::Sub(_mm256_setzero_si256(),
+                                                      ToVector()));
+  }
+
+  TACHYON_AVX2_TARGET PackedGoldilocksAvx2
+  operator*(const PackedGoldilocksAvx2& other) const {
+    return FromVector(
+        internal::goldilocks::avx2::Mul(ToVector(), other.ToVector()));
+  }
+
+  PackedGoldilocksAvx2& operator+=(const PackedGoldilocksAvx2& other) {
+    return *this = *this + other;
+  }
+  PackedGoldilocksAvx2& operator-=(const PackedGoldilocksAvx2& other) {
+    return *this = *this - other;
+  }
+  PackedGoldilocksAvx2& operator*=(const PackedGoldilocksAvx2& other) {
+    return *this = *this * other;
+  }
+
+  PackedGoldilocksAvx2 Double() const { return *this + *this; }
+  PackedGoldilocksAvx2 Square() const { return *this * *this; }
+
+  // |a[i]| *= |b[i]|
+  TACHYON_AVX2_TARGET static void BatchMulInPlace(absl::Span<F> a,
+                                                  absl::Span<const F> b) {
+    CHECK_EQ(a.size(), b.size());
+    size_t size = a.size() - a.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m256i x = LoadVector(&a[i]);
+      __m256i y = LoadVector(&b[i]);
+      StoreVector(internal::goldilocks::avx2::Mul(x, y), &a[i]);
+    }
+    for (size_t i = size; i < a.size(); ++i) {
+      a[i] *= b[i];
+    }
+  }
+
+ private:
+  static const uint64_t* ToValues(const F* values) {
+    return reinterpret_cast<const uint64_t*>(values);
+  }
+  static uint64_t* ToValues(F* values) {
+    return reinterpret_cast<uint64_t*>(values);
+  }
+
+  TACHYON_AVX2_INLINE static __m256i LoadVector(const F* values) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+  }
+
+  TACHYON_AVX2_INLINE static void StoreVector(__m256i a, F* values) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), a);
+  }
+
+  TACHYON_AVX2_INLINE __m256i ToVector() const {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values_));
+  }
+
+  TACHYON_AVX2_INLINE static PackedGoldilocksAvx2 FromVector(__m256i a) {
+    PackedGoldilocksAvx2 ret;
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ret.values_), a);
+    return ret;
+  }
+
+  // |values_[i]| is the i-th element in the canonical form.
+  uint64_t values_[kWidth] = {};
+};
+
+#endif  // defined(TACHYON_HAS_PACKED_GOLDILOCKS_AVX2)
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_AVX2_H_
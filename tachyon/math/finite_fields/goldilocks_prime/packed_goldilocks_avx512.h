@@ -0,0 +1,238 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_AVX512_H_
+#define TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_AVX512_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/prime_field_goldilocks_native.h"
+
+#if ARCH_CPU_X86_64 && defined(COMPILER_GCC) && !defined(__CUDA_ARCH__)
+#define TACHYON_HAS_PACKED_GOLDILOCKS_AVX512 1
+#include "tachyon/base/cpu_features.h"
+#include "tachyon/base/x86_intrinsics.h"
+#endif
+
+namespace tachyon::math {
+
+// |PackedGoldilocksAvx512<F>| holds 8 elements of the native Goldilocks field
+// |F| and operates on all of them at once with AVX512F.
+template <typename F, typename SFINAE = void>
+class PackedGoldilocksAvx512;
+
+// True if |PackedGoldilocksAvx512<F>| is defined. Whether it can be used on
+// the current CPU should be checked by |PackedGoldilocksAvx512<F>::
+// IsAvailable()| at runtime.
+template <typename F, typename SFINAE = void>
+constexpr bool kCanUsePackedGoldilocksAvx512 = false;
+
+#if defined(TACHYON_HAS_PACKED_GOLDILOCKS_AVX512)
+
+template <typename Config>
+constexpr bool kCanUsePackedGoldilocksAvx512<
+    PrimeField<Config>, std::enable_if_t<Config::kIsNativeGoldilocks>> = true;
+
+namespace internal::goldilocks::avx512 {
+
+// True if the CPU supports AVX512F. This is evaluated once at startup.
+inline const bool kHasAvx512f =
+    base::HasCpuFeature(base::CpuFeature::kAvx512f);
+
+constexpr size_t kWidth = 8;
+
+TACHYON_AVX512F_INLINE __m512i Canonicalize(__m512i a) {
+  // |a| - p wraps around to a value greater than |a| if and only if |a| < p.
+  return _mm512_min_epu64(a, _mm512_add_epi64(a, _mm512_set1_epi64(kEpsilon)));
+}
+
+TACHYON_AVX512F_INLINE __m512i Add(__m512i a, __m512i b) {
+  const __m512i epsilon = _mm512_set1_epi64(kEpsilon);
+  __m512i sum = _mm512_add_epi64(a, b);
+  __mmask8 carry = _mm512_cmplt_epu64_mask(sum, a);
+  sum = _mm512_mask_add_epi64(sum, carry, sum, epsilon);
+  return Canonicalize(sum);
+}
+
+TACHYON_AVX512F_INLINE __m512i Sub(__m512i a, __m512i b) {
+  __m512i diff = _mm512_sub_epi64(a, b);
+  __mmask8 borrow = _mm512_cmplt_epu64_mask(a, b);
+  return _mm512_mask_sub_epi64(diff, borrow, diff,
+                               _mm512_set1_epi64(kEpsilon));
+}
+
+// See |internal::goldilocks::Reduce128()|.
+TACHYON_AVX512F_INLINE __m512i Reduce128(__m512i hi, __m512i lo) {
+  const __m512i epsilon = _mm512_set1_epi64(kEpsilon);
+  __m512i hi_hi = _mm512_srli_epi64(hi, 32);
+  __m512i hi_lo = _mm512_and_si512(hi, epsilon);
+
+  __m512i t0 = _mm512_sub_epi64(lo, hi_hi);
+  t0 = _mm512_mask_sub_epi64(t0, _mm512_cmplt_epu64_mask(lo, hi_hi), t0,
+                             epsilon);
+  __m512i t1 = _mm512_sub_epi64(_mm512_slli_epi64(hi_lo, 32), hi_lo);
+  __m512i t2 = _mm512_add_epi64(t0, t1);
+  t2 = _mm512_mask_add_epi64(t2, _mm512_cmplt_epu64_mask(t2, t1), t2,
+                             epsilon);
+  return Canonicalize(t2);
+}
+
+// Computes the 128-bit products of |a| and |b| from 4 32-bit products.
+TACHYON_AVX512F_INLINE __m512i Mul(__m512i a, __m512i b) {
+  const __m512i mask32 = _mm512_set1_epi64(kEpsilon);
+  __m512i a_hi = _mm512_srli_epi64(a, 32);
+  __m512i b_hi = _mm512_srli_epi64(b, 32);
+  __m512i ll = _mm512_mul_epu32(a, b);
+  __m512i lh = _mm512_mul_epu32(a, b_hi);
+  __m512i hl = _mm512_mul_epu32(a_hi, b);
+  __m512i hh = _mm512_mul_epu32(a_hi, b_hi);
+
+  __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+  __m512i u = _mm512_add_epi64(lh, _mm512_and_si512(t, mask32));
+  __m512i lo = _mm512_or_si512(_mm512_slli_epi64(u, 32),
+                               _mm512_and_si512(ll, mask32));
+  __m512i hi = _mm512_add_epi64(
+      hh, _mm512_add_epi64(_mm512_srli_epi64(t, 32), _mm512_srli_epi64(u, 32)));
+  return Reduce128(hi, lo);
+}
+
+}  // namespace internal::goldilocks::avx512
+
+// All the methods require AVX512F, so they must not be called unless
+// |IsAvailable()| returns true.
+template <typename Config>
+class PackedGoldilocksAvx512<PrimeField<Config>,
+                             std::enable_if_t<Config::kIsNativeGoldilocks>>
+    final {
+ public:
+  using F = PrimeField<Config>;
+
+  constexpr static size_t kWidth = internal::goldilocks::avx512::kWidth;
+
+  static_assert(sizeof(F) == sizeof(uint64_t));
+
+  PackedGoldilocksAvx512() = default;
+
+  static bool IsAvailable() {
+    return internal::goldilocks::avx512::kHasAvx512f;
+  }
+
+  static PackedGoldilocksAvx512 Zero() { return PackedGoldilocksAvx512(); }
+
+  static PackedGoldilocksAvx512 Broadcast(const F& value) {
+    PackedGoldilocksAvx512 ret;
+    std::fill(std::begin(ret.values_), std::end(ret.values_), value[0]);
+    return ret;
+  }
+
+  // Loads |values[0]|, ..., |values[7]|.
+  static PackedGoldilocksAvx512 Load(const F* values) {
+    PackedGoldilocksAvx512 ret;
+    std::copy_n(ToValues(values), kWidth, ret.values_);
+    return ret;
+  }
+
+  // Stores the elements to |values[0]|, ..., |values[7]|.
+  void Store(F* values) const {
+    std::copy_n(values_, kWidth, ToValues(values));
+  }
+
+  F operator[](size_t i) const {
+    DCHECK_LT(i, kWidth);
+    return F(values_[i]);
+  }
+
+  bool operator==(const PackedGoldilocksAvx512& other) const {
+    return std::equal(std::begin(values_), std::end(values_),
+                      std::begin(other.values_));
+  }
+  bool operator!=(const PackedGoldilocksAvx512& other) const {
+    return !operator==(other);
+  }
+
+  TACHYON_AVX512F_TARGET PackedGoldilocksAvx512
+  operator+(const PackedGoldilocksAvx512& other) const {
+    return FromVector(
+        internal::goldilocks::avx512::Add(ToVector(), other.ToVector()));
+  }
+
+  TACHYON_AVX512F_TARGET PackedGoldilocksAvx512
+  operator-(const PackedGoldilocksAvx512& other) const {
+    return FromVector(
+        internal::goldilocks::avx512::Sub(ToVector(), other.ToVector()));
+  }
+
+  TACHYON_AVX512F_TARGET PackedGoldilocksAvx512 operator-() const {
+    return FromVector(internal::goldilocks::avx512::Sub(
+        _mm512_setzero_si512(), ToVector()));
+  }
+
+  TACHYON_AVX512F_TARGET PackedGoldilocksAvx512
+  operator*(const PackedGoldilocksAvx512& other) const {
+    return FromVector(
+        internal::goldilocks::avx512::Mul(ToVector(), other.ToVector()));
+  }
+
+  PackedGoldilocksAvx512& operator+=(const PackedGoldilocksAvx512& other) {
+    return *this = *this + other;
+  }
+  PackedGoldilocksAvx512& operator-=(const PackedGoldilocksAvx512& other) {
+    return *this = *this - other;
+  }
+  PackedGoldilocksAvx512& operator*=(const PackedGoldilocksAvx512& other) {
+    return *this = *this * other;
+  }
+
+  PackedGoldilocksAvx512 Double() const { return *this + *this; }
+  PackedGoldilocksAvx512 Square() const { return *this * *this; }
+
+  // |a[i]| *= |b[i]|
+  TACHYON_AVX512F_TARGET static void BatchMulInPlace(absl::Span<F> a,
+                                                     absl::Span<const F> b) {
+    CHECK_EQ(a.size(), b.size());
+    size_t size = a.size() - a.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m512i x = _mm512_loadu_si512(&a[i]);
+      __m512i y = _mm512_loadu_si512(&b[i]);
+      _mm512_storeu_si512(&a[i], internal::goldilocks::avx512::Mul(x, y));
+    }
+    for (size_t i = size; i < a.size(); ++i) {
+      a[i] *= b[i];
+    }
+  }
+
+ private:
+  static const uint64_t* ToValues(const F* values) {
+    return reinterpret_cast<const uint64_t*>(values);
+  }
+  static uint64_t* ToValues(F* values) {
+    return reinterpret_cast<uint64_t*>(values);
+  }
+
+  TACHYON_AVX512F_INLINE __m512i ToVector() const {
+    return _mm512_loadu_si512(values_);
+  }
+
+  TACHYON_AVX512F_INLINE static PackedGoldilocksAvx512 FromVector(__m512i a) {
+    PackedGoldilocksAvx512 ret;
+    _mm512_storeu_si512(ret.values_, a);
+    return ret;
+  }
+
+  // |values_[i]| is the i-th element in the canonical form.
+  // NOTE: This is intentionally not aligned to 64 bytes, since GCC doesn't
+  // always honor the alignment of the temporaries in the functions compiled
+  // without AVX-512.
+  uint64_t values_[kWidth] = {};
+};
+
+#endif  // defined(TACHYON_HAS_PACKED_GOLDILOCKS_AVX512)
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_AVX512_H_
@@ -0,0 +1,104 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks_avx2.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks_avx512.h"
+
+namespace tachyon::math {
+
+#if defined(TACHYON_HAS_PACKED_GOLDILOCKS_AVX2) && \
+    defined(TACHYON_HAS_PACKED_GOLDILOCKS_AVX512) && \
+    !defined(TACHYON_POLYGON_ZKEVM_BACKEND)
+
+namespace {
+
+template <typename Packed>
+class PackedGoldilocksTest : public testing::Test {
+ public:
+  void SetUp() override {
+    if (!Packed::IsAvailable()) {
+      GTEST_SKIP() << "SIMD instructions are not supported";
+    }
+    a_ = base::CreateVector(Packed::kWidth,
+                            []() { return Goldilocks::Random(); });
+    b_ = base::CreateVector(Packed::kWidth,
+                            []() { return Goldilocks::Random(); });
+    // Edge cases.
+    a_[0] = Goldilocks::Zero();
+    b_[1] = Goldilocks::Zero();
+    a_[2] = -Goldilocks::One();
+    b_[2] = -Goldilocks::One();
+    a_[3] = -Goldilocks::One();
+    b_[3] = Goldilocks(uint64_t{1} << 48);
+  }
+
+ protected:
+  std::vector<Goldilocks> a_;
+  std::vector<Goldilocks> b_;
+};
+
+}  // namespace
+
+using PackedTypes = testing::Types<PackedGoldilocksAvx2<Goldilocks>,
+                                   PackedGoldilocksAvx512<Goldilocks>>;
+TYPED_TEST_SUITE(PackedGoldilocksTest, PackedTypes);
+
+TYPED_TEST(PackedGoldilocksTest, LoadAndStore) {
+  using Packed = TypeParam;
+
+  Packed a = Packed::Load(this->a_.data());
+  std::vector<Goldilocks> stored(Packed::kWidth);
+  a.Store(stored.data());
+  EXPECT_EQ(stored, this->a_);
+
+  Goldilocks value = Goldilocks::Random();
+  Packed broadcast = Packed::Broadcast(value);
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    EXPECT_EQ(broadcast[i], value);
+  }
+}
+
+TYPED_TEST(PackedGoldilocksTest, Arithmetics) {
+  using Packed = TypeParam;
+
+  Packed a = Packed::Load(this->a_.data());
+  Packed b = Packed::Load(this->b_.data());
+  Packed sum = a + b;
+  Packed diff = a - b;
+  Packed neg = -a;
+  Packed product = a * b;
+  Packed square = a.Square();
+  Packed dbl = a.Double();
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    const Goldilocks& x = this->a_[i];
+    const Goldilocks& y = this->b_[i];
+    EXPECT_EQ(sum[i], x + y);
+    EXPECT_EQ(diff[i], x - y);
+    EXPECT_EQ(neg[i], -x);
+    EXPECT_EQ(product[i], x * y);
+    EXPECT_EQ(square[i], x.Square());
+    EXPECT_EQ(dbl[i], x.Double());
+  }
+}
+
+TYPED_TEST(PackedGoldilocksTest, BatchMulInPlace) {
+  using Packed = TypeParam;
+
+  for (size_t size : {size_t{0}, size_t{5}, size_t{8}, size_t{27}}) {
+    std::vector<Goldilocks> a =
+        base::CreateVector(size, []() { return Goldilocks::Random(); });
+    std::vector<Goldilocks> b =
+        base::CreateVector(size, []() { return Goldilocks::Random(); });
+    std::vector<Goldilocks> expected = base::CreateVector(
+        size, [&a, &b](size_t i) { return a[i] * b[i]; });
+    Packed::BatchMulInPlace(absl::MakeSpan(a), b);
+    EXPECT_EQ(a, expected);
+  }
+}
+
+#endif
+
+}  // namespace tachyon::math
@@ -0,0 +1,255 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PRIME_FIELD_GOLDILOCKS_NATIVE_H_
+#define TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PRIME_FIELD_GOLDILOCKS_NATIVE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "absl/numeric/int128.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/prime_field_base.h"
+
+namespace tachyon::math {
+namespace internal::goldilocks {
+
+// p = 2⁶⁴ - 2³² + 1
+constexpr uint64_t kModulus = UINT64_C(0xffffffff00000001);
+// ε = 2⁶⁴ - p = 2³² - 1
+constexpr uint64_t kEpsilon = UINT64_C(0xffffffff);
+
+// NOTE: The functions below are written without branches, since the
+// branches depend on the values and are hard to predict.
+
+// Returns |a| mod p for |a| in [0, 2⁶⁴).
+constexpr uint64_t Canonicalize(uint64_t a) {
+  uint64_t t = a - kModulus;
+  return a < kModulus ? a : t;
+}
+
+// Returns |a| + |b| mod p for |a| and |b| in [0, p).
+constexpr uint64_t Add(uint64_t a, uint64_t b) {
+  uint64_t sum = a + b;
+  // 2⁶⁴ ≡ ε (mod p). This never overflows since |a| + |b| < 2p.
+  sum += kEpsilon & -uint64_t{sum < a};
+  return Canonicalize(sum);
+}
+
+// Returns |a| - |b| mod p for |a| and |b| in [0, p).
+constexpr uint64_t Sub(uint64_t a, uint64_t b) {
+  uint64_t diff = a - b;
+  // Adding p is the same as subtracting ε modulo 2⁶⁴.
+  return diff - (kEpsilon & -uint64_t{a < b});
+}
+
+// Returns |hi| * 2⁶⁴ + |lo| mod p.
+//
+// Let |hi| = h₁ * 2³² + h₀. Since 2⁶⁴ ≡ 2³² - 1 and 2⁹⁶ ≡ -1 (mod p),
+// |hi| * 2⁶⁴ + |lo| ≡ |lo| - h₁ + h₀ * (2³² - 1) (mod p).
+constexpr uint64_t Reduce128(uint64_t hi, uint64_t lo) {
+  uint64_t hi_hi = hi >> 32;
+  uint64_t hi_lo = hi & kEpsilon;
+
+  uint64_t t0 = lo - hi_hi;
+  t0 -= kEpsilon & -uint64_t{lo < hi_hi};
+  // This never overflows since |hi_lo| < 2³².
+  uint64_t t1 = (hi_lo << 32) - hi_lo;
+  uint64_t t2 = t0 + t1;
+  t2 += kEpsilon & -uint64_t{t2 < t1};
+  return Canonicalize(t2);
+}
+
+// Returns |a| * |b| mod p.
+inline uint64_t Mul(uint64_t a, uint64_t b) {
+  absl::uint128 product = absl::uint128(a) * absl::uint128(b);
+  return Reduce128(absl::Uint128High64(product), absl::Uint128Low64(product));
+}
+
+}  // namespace internal::goldilocks
+
+// A prime field for p = 2⁶⁴ - 2³² + 1, which is known as Goldilocks.
+// Unlike the generic |PrimeField|, the elements are kept in the canonical
+// form, not in the montgomery form, and the multiplication is reduced with
+// the special form of p.
+template <typename _Config>
+class PrimeField<_Config, std::enable_if_t<_Config::kIsNativeGoldilocks>> final
+    : public PrimeFieldBase<PrimeField<_Config>> {
+ public:
+  constexpr static size_t kModulusBits = _Config::kModulusBits;
+  constexpr static size_t kLimbNums = (kModulusBits + 63) / 64;
+  constexpr static size_t N = kLimbNums;
+
+  using Config = _Config;
+  using BigIntTy = BigInt<N>;
+  using MontgomeryTy = BigInt<N>;
+  using value_type = BigInt<N>;
+
+  static_assert(N == 1);
+  static_assert(Config::kModulus[0] == internal::goldilocks::kModulus);
+
+  constexpr PrimeField() = default;
+  constexpr explicit PrimeField(uint64_t value)
+      : value_(internal::goldilocks::Canonicalize(value)) {}
+  constexpr explicit PrimeField(const BigInt<N>& value) : value_(value) {
+    DCHECK_LT(value_, Config::kModulus);
+  }
+  constexpr PrimeField(const PrimeField& other) = default;
+  constexpr PrimeField& operator=(const PrimeField& other) = default;
+  constexpr PrimeField(PrimeField&& other) = default;
+  constexpr PrimeField& operator=(PrimeField&& other) = default;
+
+  constexpr static PrimeField Zero() { return PrimeField(); }
+
+  constexpr static PrimeField One() { return PrimeField(uint64_t{1}); }
+
+  static PrimeField Random() {
+    return PrimeField(BigInt<N>::Random(Config::kModulus));
+  }
+
+  static uint64_t RandomForTesting() { return Random().value_[0]; }
+
+  constexpr static PrimeField FromDecString(std::string_view str) {
+    return PrimeField(BigInt<N>::FromDecString(str));
+  }
+  constexpr static PrimeField FromHexString(std::string_view str) {
+    return PrimeField(BigInt<N>::FromHexString(str));
+  }
+
+  constexpr static PrimeField FromBigInt(const BigInt<N>& big_int) {
+    return PrimeField(big_int);
+  }
+
+  constexpr static PrimeField FromMontgomery(const MontgomeryTy& mont) {
+    return PrimeField(BigInt<N>::FromMontgomery64(mont, Config::kModulus,
+                                                  Config::kInverse64));
+  }
+
+  static PrimeField FromMpzClass(const mpz_class& value) {
+    BigInt<N> big_int;
+    gmp::CopyLimbs(value, big_int.limbs);
+    return FromBigInt(big_int);
+  }
+
+  static void Init() {
+    // Do nothing.
+  }
+
+  const value_type& value() const { return value_; }
+  size_t GetLimbSize() const { return N; }
+
+  constexpr bool IsZero() const { return value_[0] == 0; }
+
+  constexpr bool IsOne() const { return value_[0] == 1; }
+
+  std::string ToString() const { return value_.ToString(); }
+  std::string ToHexString(bool pad_zero = false) const {
+    return value_.ToHexString(pad_zero);
+  }
+
+  mpz_class ToMpzClass() const {
+    mpz_class ret;
+    gmp::WriteLimbs(value_.limbs, N, &ret);
+    return ret;
+  }
+
+  constexpr const BigInt<N>& ToBigInt() const { return value_; }
+
+  // Returns |value_| * 2⁶⁴ mod p, which is compatible with the montgomery
+  // form of the generic |PrimeField|.
+  BigInt<N> ToMontgomery() const {
+    return BigInt<N>(
+        internal::goldilocks::Mul(value_[0], Config::kMontgomeryR[0]));
+  }
+
+  explicit operator uint64_t() const { return value_[0]; }
+
+  constexpr uint64_t& operator[](size_t i) { return value_[i]; }
+  constexpr const uint64_t& operator[](size_t i) const { return value_[i]; }
+
+  constexpr bool operator==(const PrimeField& other) const {
+    return value_[0] == other.value_[0];
+  }
+
+  constexpr bool operator!=(const PrimeField& other) const {
+    return value_[0] != other.value_[0];
+  }
+
+  constexpr bool operator<(const PrimeField& other) const {
+    return value_[0] < other.value_[0];
+  }
+
+  constexpr bool operator>(const PrimeField& other) const {
+    return value_[0] > other.value_[0];
+  }
+
+  constexpr bool operator<=(const PrimeField& other) const {
+    return value_[0] <= other.value_[0];
+  }
+
+  constexpr bool operator>=(const PrimeField& other) const {
+    return value_[0] >= other.value_[0];
+  }
+
+  // This is needed by MSM.
+  // See tachyon/math/elliptic_curves/msm/variable_base_msm.h
+  BigInt<N> DivBy2Exp(uint32_t exp) const {
+    BigInt<N> ret = value_;
+    return ret.DivBy2ExpInPlace(exp);
+  }
+
+  // AdditiveSemigroup methods
+  constexpr PrimeField& AddInPlace(const PrimeField& other) {
+    value_[0] = internal::goldilocks::Add(value_[0], other.value_[0]);
+    return *this;
+  }
+
+  constexpr PrimeField& DoubleInPlace() {
+    value_[0] = internal::goldilocks::Add(value_[0], value_[0]);
+    return *this;
+  }
+
+  // AdditiveGroup methods
+  constexpr PrimeField& SubInPlace(const PrimeField& other) {
+    value_[0] = internal::goldilocks::Sub(value_[0], other.value_[0]);
+    return *this;
+  }
+
+  constexpr PrimeField& NegInPlace() {
+    value_[0] = internal::goldilocks::Sub(0, value_[0]);
+    return *this;
+  }
+
+  // MultiplicativeSemigroup methods
+  PrimeField& MulInPlace(const PrimeField& other) {
+    value_[0] = internal::goldilocks::Mul(value_[0], other.value_[0]);
+    return *this;
+  }
+
+  PrimeField& SquareInPlace() {
+    value_[0] = internal::goldilocks::Mul(value_[0], value_[0]);
+    return *this;
+  }
+
+  // MultiplicativeGroup methods
+  PrimeField& DivInPlace(const PrimeField& other) {
+    return MulInPlace(other.Inverse());
+  }
+
+  PrimeField& InverseInPlace() {
+    // See https://github.com/kroma-network/tachyon/issues/76
+    CHECK(!IsZero());
+    // a⁻¹ = aᵖ⁻² by Fermat's little theorem.
+    *this = this->Pow(BigInt<N>(internal::goldilocks::kModulus - 2));
+    return *this;
+  }
+
+ private:
+  BigInt<N> value_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PRIME_FIELD_GOLDILOCKS_NATIVE_H_
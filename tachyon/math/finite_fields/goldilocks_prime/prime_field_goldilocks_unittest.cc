@@ -3,6 +3,8 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks_2.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks_3.h"
 
 namespace tachyon::math {
 
@@ -141,4 +143,53 @@ TEST(PrimeFieldGoldilocksTest, MultiplicativeGroupOperators) {
   EXPECT_EQ(f * f * f * f * f, f_pow);
 }
 
+TEST(PrimeFieldGoldilocksTest, Reduction) {
+  Goldilocks minus_one = -Goldilocks::One();
+  EXPECT_EQ(static_cast<uint64_t>(minus_one),
+            Goldilocks::Config::kModulus[0] - 1);
+  EXPECT_EQ(minus_one * minus_one, Goldilocks::One());
+  EXPECT_EQ(minus_one + Goldilocks::One(), Goldilocks::Zero());
+  EXPECT_EQ(Goldilocks::Zero() - Goldilocks::One(), minus_one);
+  EXPECT_EQ(Goldilocks(Goldilocks::Config::kModulus[0]), Goldilocks::Zero());
+  // 2⁹⁶ ≡ -1 (mod p)
+  EXPECT_EQ(Goldilocks(uint64_t{1} << 48).Square(), minus_one);
+}
+
+TEST(PrimeFieldGoldilocksTest, RootOfUnity) {
+  Goldilocks root;
+  ASSERT_TRUE(Goldilocks::GetRootOfUnity(uint64_t{1} << 32, &root));
+  EXPECT_EQ(root.Pow(uint64_t{1} << 31), -Goldilocks::One());
+  EXPECT_EQ(root.Pow(uint64_t{1} << 32), Goldilocks::One());
+}
+
+template <typename ExtField>
+class GoldilocksExtensionFieldTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { ExtField::Init(); }
+};
+
+using ExtFieldTypes = testing::Types<Goldilocks2, Goldilocks3>;
+TYPED_TEST_SUITE(GoldilocksExtensionFieldTest, ExtFieldTypes);
+
+TYPED_TEST(GoldilocksExtensionFieldTest, MultiplicativeGroupOperators) {
+  using ExtField = TypeParam;
+
+  ExtField a = ExtField::Random();
+  ExtField b = ExtField::Random();
+  ExtField c = ExtField::Random();
+  EXPECT_EQ(a * a.Inverse(), ExtField::One());
+  EXPECT_EQ(a.Square(), a * a);
+  EXPECT_EQ((a + b) * c, a * c + b * c);
+  EXPECT_EQ(a * b / b, a);
+}
+
+TYPED_TEST(GoldilocksExtensionFieldTest, FrobeniusMap) {
+  using ExtField = TypeParam;
+
+  ExtField a = ExtField::Random();
+  ExtField a_pow = a.Pow(Goldilocks::Config::kModulus);
+  a.FrobeniusMapInPlace(1);
+  EXPECT_EQ(a_pow, a);
+}
+
 }  // namespace tachyon::math
@@ -0,0 +1,121 @@
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/mersenne31/mersenne31.h"
+#include "tachyon/math/finite_fields/mersenne31/mersenne31_2.h"
+
+namespace tachyon::math {
+
+TEST(Mersenne31Test, FromString) {
+  EXPECT_EQ(Mersenne31::FromDecString("3"), Mersenne31(3));
+  EXPECT_EQ(Mersenne31::FromHexString("0x3"), Mersenne31(3));
+}
+
+TEST(Mersenne31Test, ToString) {
+  Mersenne31 f(3);
+
+  EXPECT_EQ(f.ToString(), "3");
+  EXPECT_EQ(f.ToHexString(), "0x3");
+}
+
+TEST(Mersenne31Test, Zero) {
+  EXPECT_TRUE(Mersenne31::Zero().IsZero());
+  EXPECT_FALSE(Mersenne31::One().IsZero());
+}
+
+TEST(Mersenne31Test, One) {
+  EXPECT_TRUE(Mersenne31::One().IsOne());
+  EXPECT_FALSE(Mersenne31::Zero().IsOne());
+  EXPECT_EQ(Mersenne31::Config::kOne, Mersenne31(1).ToMontgomery());
+}
+
+TEST(Mersenne31Test, BigIntConversion) {
+  Mersenne31 r = Mersenne31::Random();
+  EXPECT_EQ(Mersenne31::FromBigInt(r.ToBigInt()), r);
+}
+
+TEST(Mersenne31Test, MontgomeryConversion) {
+  Mersenne31 r = Mersenne31::Random();
+  EXPECT_EQ(Mersenne31::FromMontgomery(r.ToMontgomery()), r);
+}
+
+TEST(Mersenne31Test, MpzClassConversion) {
+  Mersenne31 r = Mersenne31::Random();
+  EXPECT_EQ(Mersenne31::FromMpzClass(r.ToMpzClass()), r);
+}
+
+TEST(Mersenne31Test, ComparisonOperator) {
+  Mersenne31 f(3);
+  Mersenne31 f2(4);
+  EXPECT_TRUE(f < f2);
+  EXPECT_TRUE(f <= f2);
+  EXPECT_FALSE(f > f2);
+  EXPECT_FALSE(f >= f2);
+}
+
+TEST(Mersenne31Test, Operators) {
+  uint64_t M = Mersenne31::Config::kModulus[0];
+
+  uint64_t a = Mersenne31::RandomForTesting();
+  uint64_t b = Mersenne31::RandomForTesting();
+  SCOPED_TRACE(absl::Substitute("a: $0, b: $1", a, b));
+
+  Mersenne31 fa(a);
+  Mersenne31 fb(b);
+
+  EXPECT_EQ(static_cast<uint32_t>(fa + fb), (a + b) % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa - fb), (a + M - b) % M);
+  EXPECT_EQ(static_cast<uint32_t>(-fa), (M - a) % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa.Double()), (a + a) % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa * fb), a * b % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa.Square()), a * a % M);
+  if (!fb.IsZero()) {
+    EXPECT_EQ(fa * fb / fb, fa);
+    EXPECT_EQ(fb * fb.Inverse(), Mersenne31::One());
+  }
+}
+
+TEST(Mersenne31Test, Reduction) {
+  Mersenne31 minus_one = -Mersenne31::One();
+  EXPECT_EQ(static_cast<uint32_t>(minus_one),
+            Mersenne31::Config::kModulus[0] - 1);
+  EXPECT_EQ(minus_one * minus_one, Mersenne31::One());
+  EXPECT_EQ(minus_one + Mersenne31::One(), Mersenne31::Zero());
+  EXPECT_EQ(Mersenne31::Zero() - Mersenne31::One(), minus_one);
+  EXPECT_EQ(Mersenne31(Mersenne31::Config::kModulus[0]), Mersenne31::Zero());
+  EXPECT_EQ(Mersenne31(UINT32_MAX), Mersenne31(1));
+  // 2³¹ ≡ 1 (mod p)
+  EXPECT_EQ(Mersenne31(uint32_t{1} << 30).Double(), Mersenne31::One());
+}
+
+TEST(Mersenne31Test, RootOfUnity) {
+  Mersenne31 root;
+  // The two-adicity of p - 1 is just 1.
+  ASSERT_TRUE(Mersenne31::GetRootOfUnity(2, &root));
+  EXPECT_EQ(root, -Mersenne31::One());
+  EXPECT_FALSE(Mersenne31::GetRootOfUnity(4, &root));
+}
+
+class Mersenne31ExtensionFieldTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Mersenne31_2::Init(); }
+};
+
+TEST_F(Mersenne31ExtensionFieldTest, MultiplicativeGroupOperators) {
+  Mersenne31_2 a = Mersenne31_2::Random();
+  Mersenne31_2 b = Mersenne31_2::Random();
+  Mersenne31_2 c = Mersenne31_2::Random();
+  EXPECT_EQ(a * a.Inverse(), Mersenne31_2::One());
+  EXPECT_EQ(a.Square(), a * a);
+  EXPECT_EQ((a + b) * c, a * c + b * c);
+  EXPECT_EQ(a * b / b, a);
+}
+
+TEST_F(Mersenne31ExtensionFieldTest, FrobeniusMap) {
+  Mersenne31_2 a = Mersenne31_2::Random();
+  Mersenne31_2 a_pow = a.Pow(Mersenne31::Config::kModulus);
+  a.FrobeniusMapInPlace(1);
+  EXPECT_EQ(a_pow, a);
+}
+
+}  // namespace tachyon::math
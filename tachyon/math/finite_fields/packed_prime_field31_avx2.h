@@ -0,0 +1,265 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD31_AVX2_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD31_AVX2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bit_cast.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/finite_fields/prime_field_mersenne31.h"
+#include "tachyon/math/finite_fields/prime_field_mont31.h"
+
+#if ARCH_CPU_X86_64 && defined(COMPILER_GCC) && !defined(__CUDA_ARCH__)
+#define TACHYON_HAS_PACKED_PRIME_FIELD31_AVX2 1
+#include "tachyon/base/cpu_features.h"
+#include "tachyon/base/x86_intrinsics.h"
+#endif
+
+namespace tachyon::math {
+
+// |PackedPrimeField31Avx2<F>| holds 8 elements of a 31-bit prime field |F|
+// and operates on all of them at once with AVX2.
+template <typename F, typename SFINAE = void>
+class PackedPrimeField31Avx2;
+
+// True if |PackedPrimeField31Avx2<F>| is defined. Whether it can be used on
+// the current CPU should be checked by |PackedPrimeField31Avx2<F>::
+// IsAvailable()| at runtime.
+template <typename F, typename SFINAE = void>
+constexpr bool kCanUsePackedPrimeField31Avx2 = false;
+
+#if defined(TACHYON_HAS_PACKED_PRIME_FIELD31_AVX2)
+
+template <typename Config>
+constexpr bool kCanUsePackedPrimeField31Avx2<
+    PrimeField<Config>, std::enable_if_t<Config::kIsMont31>> = true;
+
+template <typename Config>
+constexpr bool kCanUsePackedPrimeField31Avx2<
+    PrimeField<Config>, std::enable_if_t<Config::kIsMersenne31>> = true;
+
+namespace internal::prime_field31::avx2 {
+
+// True if the CPU supports AVX2. This is evaluated once at startup.
+inline const bool kHasAvx2 = base::HasCpuFeature(base::CpuFeature::kAvx2);
+
+constexpr size_t kWidth = 8;
+
+// See |internal::mont31::Add()|.
+TACHYON_AVX2_INLINE __m256i Add(__m256i a, __m256i b, __m256i p) {
+  __m256i sum = _mm256_add_epi32(a, b);
+  return _mm256_min_epu32(sum, _mm256_sub_epi32(sum, p));
+}
+
+// See |internal::mont31::Sub()|.
+TACHYON_AVX2_INLINE __m256i Sub(__m256i a, __m256i b, __m256i p) {
+  __m256i diff = _mm256_sub_epi32(a, b);
+  return _mm256_min_epu32(diff, _mm256_add_epi32(diff, p));
+}
+
+// Returns the 64-bit products of the even and the odd lanes of |a| and |b|.
+// The products of the odd lanes are computed by moving them to the even lanes,
+// since _mm256_mul_epu32() only multiplies the even lanes.
+TACHYON_AVX2_INLINE void MulEvenOdd(__m256i a, __m256i b, __m256i* evn,
+                                    __m256i* odd) {
+  *evn = _mm256_mul_epu32(a, b);
+  *odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+}
+
+// Returns the upper halves of the 64-bit lanes of |evn| and |odd| as the
+// even and the odd 32-bit lanes respectively.
+TACHYON_AVX2_INLINE __m256i BlendHi(__m256i evn, __m256i odd) {
+  return _mm256_blend_epi32(_mm256_srli_epi64(evn, 32), odd, 0b10101010);
+}
+
+// See |internal::mont31::Mul()|.
+TACHYON_AVX2_INLINE __m256i MontMul(__m256i a, __m256i b, __m256i p,
+                                    __m256i mu) {
+  __m256i prod_evn, prod_odd;
+  MulEvenOdd(a, b, &prod_evn, &prod_odd);
+  // Only the lower 32 bits of |q| are used.
+  __m256i q_evn = _mm256_mul_epu32(prod_evn, mu);
+  __m256i q_odd = _mm256_mul_epu32(prod_odd, mu);
+  __m256i qp_evn = _mm256_mul_epu32(q_evn, p);
+  __m256i qp_odd = _mm256_mul_epu32(q_odd, p);
+  __m256i diff = _mm256_sub_epi32(BlendHi(prod_evn, prod_odd),
+                                  BlendHi(qp_evn, qp_odd));
+  return _mm256_min_epu32(diff, _mm256_add_epi32(diff, p));
+}
+
+// See |internal::mersenne31::Mul()|.
+TACHYON_AVX2_INLINE __m256i MersenneMul(__m256i a, __m256i b, __m256i p) {
+  const __m256i mask = _mm256_set1_epi64x(internal::mersenne31::kModulus);
+  __m256i prod_evn, prod_odd;
+  MulEvenOdd(a, b, &prod_evn, &prod_odd);
+  // Both fit in 32 bits since x₀ < 2³¹ and x₁ < 2³¹.
+  __m256i r_evn = _mm256_add_epi64(_mm256_and_si256(prod_evn, mask),
+                                   _mm256_srli_epi64(prod_evn, 31));
+  __m256i r_odd = _mm256_add_epi64(_mm256_and_si256(prod_odd, mask),
+                                   _mm256_srli_epi64(prod_odd, 31));
+  __m256i r =
+      _mm256_blend_epi32(r_evn, _mm256_slli_epi64(r_odd, 32), 0b10101010);
+  return _mm256_min_epu32(r, _mm256_sub_epi32(r, p));
+}
+
+}  // namespace internal::prime_field31::avx2
+
+// The elements are kept in the same form as |F|, i.e., in the montgomery form
+// with R = 2³² for BabyBear and KoalaBear and in the canonical form for
+// Mersenne31, so that loading and storing don't need any conversion.
+//
+// All the methods require AVX2, so they must not be called unless
+// |IsAvailable()| returns true.
+template <typename _F>
+class PackedPrimeField31Avx2<
+    _F, std::enable_if_t<kCanUsePackedPrimeField31Avx2<_F>>>
+    final {
+ public:
+  using F = _F;
+
+  constexpr static size_t kWidth = internal::prime_field31::avx2::kWidth;
+
+  static_assert(sizeof(F) == sizeof(uint32_t));
+
+  PackedPrimeField31Avx2() = default;
+
+  static bool IsAvailable() { return internal::prime_field31::avx2::kHasAvx2; }
+
+  static PackedPrimeField31Avx2 Zero() { return PackedPrimeField31Avx2(); }
+
+  static PackedPrimeField31Avx2 Broadcast(const F& value) {
+    PackedPrimeField31Avx2 ret;
+    std::fill(std::begin(ret.values_), std::end(ret.values_),
+              base::bit_cast<uint32_t>(value));
+    return ret;
+  }
+
+  // Loads |values[0]|, ..., |values[7]|.
+  static PackedPrimeField31Avx2 Load(const F* values) {
+    PackedPrimeField31Avx2 ret;
+    std::copy_n(ToValues(values), kWidth, ret.values_);
+    return ret;
+  }
+
+  // Stores the elements to |values[0]|, ..., |values[7]|.
+  void Store(F* values) const {
+    std::copy_n(values_, kWidth, ToValues(values));
+  }
+
+  F operator[](size_t i) const {
+    DCHECK_LT(i, kWidth);
+    return base::bit_cast<F>(values_[i]);
+  }
+
+  bool operator==(const PackedPrimeField31Avx2& other) const {
+    return std::equal(std::begin(values_), std::end(values_),
+                      std::begin(other.values_));
+  }
+  bool operator!=(const PackedPrimeField31Avx2& other) const {
+    return !operator==(other);
+  }
+
+  TACHYON_AVX2_TARGET PackedPrimeField31Avx2
+  operator+(const PackedPrimeField31Avx2& other) const {
+    return FromVector(internal::prime_field31::avx2::Add(
+        ToVector(), other.ToVector(), GetModulus()));
+  }
+
+  TACHYON_AVX2_TARGET PackedPrimeField31Avx2
+  operator-(const PackedPrimeField31Avx2& other) const {
+    return FromVector(internal::prime_field31::avx2::Sub(
+        ToVector(), other.ToVector(), GetModulus()));
+  }
+
+  TACHYON_AVX2_TARGET PackedPrimeField31Avx2 operator-() const {
+    return FromVector(internal::prime_field31::avx2::Sub(
+        _mm256_setzero_si256(), ToVector(), GetModulus()));
+  }
+
+  TACHYON_AVX2_TARGET PackedPrimeField31Avx2
+  operator*(const PackedPrimeField31Avx2& other) const {
+    return FromVector(Mul(ToVector(), other.ToVector()));
+  }
+
+  PackedPrimeField31Avx2& operator+=(const PackedPrimeField31Avx2& other) {
+    return *this = *this + other;
+  }
+  PackedPrimeField31Avx2& operator-=(const PackedPrimeField31Avx2& other) {
+    return *this = *this - other;
+  }
+  PackedPrimeField31Avx2& operator*=(const PackedPrimeField31Avx2& other) {
+    return *this = *this * other;
+  }
+
+  PackedPrimeField31Avx2 Double() const { return *this + *this; }
+  PackedPrimeField31Avx2 Square() const { return *this * *this; }
+
+  // |a[i]| *= |b[i]|
+  TACHYON_AVX2_TARGET static void BatchMulInPlace(absl::Span<F> a,
+                                                  absl::Span<const F> b) {
+    CHECK_EQ(a.size(), b.size());
+    size_t size = a.size() - a.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m256i x = LoadVector(&a[i]);
+      __m256i y = LoadVector(&b[i]);
+      StoreVector(Mul(x, y), &a[i]);
+    }
+    for (size_t i = size; i < a.size(); ++i) {
+      a[i] *= b[i];
+    }
+  }
+
+ private:
+  static const uint32_t* ToValues(const F* values) {
+    return reinterpret_cast<const uint32_t*>(values);
+  }
+  static uint32_t* ToValues(F* values) {
+    return reinterpret_cast<uint32_t*>(values);
+  }
+
+  TACHYON_AVX2_INLINE static __m256i GetModulus() {
+    return _mm256_set1_epi32(F::kModulus);
+  }
+
+  TACHYON_AVX2_INLINE static __m256i Mul(__m256i a, __m256i b) {
+    if constexpr (F::kModulus == internal::mersenne31::kModulus) {
+      return internal::prime_field31::avx2::MersenneMul(a, b, GetModulus());
+    } else {
+      return internal::prime_field31::avx2::MontMul(
+          a, b, GetModulus(), _mm256_set1_epi32(F::kMu));
+    }
+  }
+
+  TACHYON_AVX2_INLINE static __m256i LoadVector(const F* values) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+  }
+
+  TACHYON_AVX2_INLINE static void StoreVector(__m256i a, F* values) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), a);
+  }
+
+  TACHYON_AVX2_INLINE __m256i ToVector() const {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values_));
+  }
+
+  TACHYON_AVX2_INLINE static PackedPrimeField31Avx2 FromVector(__m256i a) {
+    PackedPrimeField31Avx2 ret;
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ret.values_), a);
+    return ret;
+  }
+
+  // |values_[i]| is the i-th element in the same form as |F|.
+  uint32_t values_[kWidth] = {};
+};
+
+#endif  // defined(TACHYON_HAS_PACKED_PRIME_FIELD31_AVX2)
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD31_AVX2_H_
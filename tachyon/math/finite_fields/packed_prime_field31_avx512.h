@@ -0,0 +1,271 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD31_AVX512_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD31_AVX512_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bit_cast.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/finite_fields/prime_field_mersenne31.h"
+#include "tachyon/math/finite_fields/prime_field_mont31.h"
+
+#if ARCH_CPU_X86_64 && defined(COMPILER_GCC) && !defined(__CUDA_ARCH__)
+#define TACHYON_HAS_PACKED_PRIME_FIELD31_AVX512 1
+#include "tachyon/base/cpu_features.h"
+#include "tachyon/base/x86_intrinsics.h"
+#endif
+
+namespace tachyon::math {
+
+// |PackedPrimeField31Avx512<F>| holds 16 elements of a 31-bit prime field |F|
+// and operates on all of them at once with AVX512F.
+template <typename F, typename SFINAE = void>
+class PackedPrimeField31Avx512;
+
+// True if |PackedPrimeField31Avx512<F>| is defined. Whether it can be used on
+// the current CPU should be checked by |PackedPrimeField31Avx512<F>::
+// IsAvailable()| at runtime.
+template <typename F, typename SFINAE = void>
+constexpr bool kCanUsePackedPrimeField31Avx512 = false;
+
+#if defined(TACHYON_HAS_PACKED_PRIME_FIELD31_AVX512)
+
+template <typename Config>
+constexpr bool kCanUsePackedPrimeField31Avx512<
+    PrimeField<Config>, std::enable_if_t<Config::kIsMont31>> = true;
+
+template <typename Config>
+constexpr bool kCanUsePackedPrimeField31Avx512<
+    PrimeField<Config>, std::enable_if_t<Config::kIsMersenne31>> = true;
+
+namespace internal::prime_field31::avx512 {
+
+// True if the CPU supports AVX512F. This is evaluated once at startup.
+inline const bool kHasAvx512f =
+    base::HasCpuFeature(base::CpuFeature::kAvx512f);
+
+constexpr size_t kWidth = 16;
+
+// The odd 32-bit lanes.
+constexpr __mmask16 kOddMask = 0b1010101010101010;
+
+// See |internal::mont31::Add()|.
+TACHYON_AVX512F_INLINE __m512i Add(__m512i a, __m512i b, __m512i p) {
+  __m512i sum = _mm512_add_epi32(a, b);
+  return _mm512_min_epu32(sum, _mm512_sub_epi32(sum, p));
+}
+
+// See |internal::mont31::Sub()|.
+TACHYON_AVX512F_INLINE __m512i Sub(__m512i a, __m512i b, __m512i p) {
+  __m512i diff = _mm512_sub_epi32(a, b);
+  return _mm512_min_epu32(diff, _mm512_add_epi32(diff, p));
+}
+
+// Returns the 64-bit products of the even and the odd lanes of |a| and |b|.
+// The products of the odd lanes are computed by moving them to the even lanes,
+// since _mm512_mul_epu32() only multiplies the even lanes.
+TACHYON_AVX512F_INLINE void MulEvenOdd(__m512i a, __m512i b, __m512i* evn,
+                                    __m512i* odd) {
+  *evn = _mm512_mul_epu32(a, b);
+  *odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+}
+
+// Returns the upper halves of the 64-bit lanes of |evn| and |odd| as the
+// even and the odd 32-bit lanes respectively.
+TACHYON_AVX512F_INLINE __m512i BlendHi(__m512i evn, __m512i odd) {
+  return _mm512_mask_blend_epi32(kOddMask, _mm512_srli_epi64(evn, 32), odd);
+}
+
+// See |internal::mont31::Mul()|.
+TACHYON_AVX512F_INLINE __m512i MontMul(__m512i a, __m512i b, __m512i p,
+                                    __m512i mu) {
+  __m512i prod_evn, prod_odd;
+  MulEvenOdd(a, b, &prod_evn, &prod_odd);
+  // Only the lower 32 bits of |q| are used.
+  __m512i q_evn = _mm512_mul_epu32(prod_evn, mu);
+  __m512i q_odd = _mm512_mul_epu32(prod_odd, mu);
+  __m512i qp_evn = _mm512_mul_epu32(q_evn, p);
+  __m512i qp_odd = _mm512_mul_epu32(q_odd, p);
+  __m512i diff = _mm512_sub_epi32(BlendHi(prod_evn, prod_odd),
+                                  BlendHi(qp_evn, qp_odd));
+  return _mm512_min_epu32(diff, _mm512_add_epi32(diff, p));
+}
+
+// See |internal::mersenne31::Mul()|.
+TACHYON_AVX512F_INLINE __m512i MersenneMul(__m512i a, __m512i b, __m512i p) {
+  const __m512i mask = _mm512_set1_epi64(internal::mersenne31::kModulus);
+  __m512i prod_evn, prod_odd;
+  MulEvenOdd(a, b, &prod_evn, &prod_odd);
+  // Both fit in 32 bits since x₀ < 2³¹ and x₁ < 2³¹.
+  __m512i r_evn = _mm512_add_epi64(_mm512_and_si512(prod_evn, mask),
+                                   _mm512_srli_epi64(prod_evn, 31));
+  __m512i r_odd = _mm512_add_epi64(_mm512_and_si512(prod_odd, mask),
+                                   _mm512_srli_epi64(prod_odd, 31));
+  __m512i r =
+      _mm512_mask_blend_epi32(kOddMask, r_evn, _mm512_slli_epi64(r_odd, 32));
+  return _mm512_min_epu32(r, _mm512_sub_epi32(r, p));
+}
+
+}  // namespace internal::prime_field31::avx512
+
+// The elements are kept in the same form as |F|, i.e., in the montgomery form
+// with R = 2³² for BabyBear and KoalaBear and in the canonical form for
+// Mersenne31, so that loading and storing don't need any conversion.
+//
+// All the methods require AVX512F, so they must not be called unless
+// |IsAvailable()| returns true.
+template <typename _F>
+class PackedPrimeField31Avx512<
+    _F, std::enable_if_t<kCanUsePackedPrimeField31Avx512<_F>>>
+    final {
+ public:
+  using F = _F;
+
+  constexpr static size_t kWidth = internal::prime_field31::avx512::kWidth;
+
+  static_assert(sizeof(F) == sizeof(uint32_t));
+
+  PackedPrimeField31Avx512() = default;
+
+  static bool IsAvailable() {
+    return internal::prime_field31::avx512::kHasAvx512f;
+  }
+
+  static PackedPrimeField31Avx512 Zero() { return PackedPrimeField31Avx512(); }
+
+  static PackedPrimeField31Avx512 Broadcast(const F& value) {
+    PackedPrimeField31Avx512 ret;
+    std::fill(std::begin(ret.values_), std::end(ret.values_),
+              base::bit_cast<uint32_t>(value));
+    return ret;
+  }
+
+  // Loads |values[0]|, ..., |values[15]|.
+  static PackedPrimeField31Avx512 Load(const F* values) {
+    PackedPrimeField31Avx512 ret;
+    std::copy_n(ToValues(values), kWidth, ret.values_);
+    return ret;
+  }
+
+  // Stores the elements to |values[0]|, ..., |values[15]|.
+  void Store(F* values) const {
+    std::copy_n(values_, kWidth, ToValues(values));
+  }
+
+  F operator[](size_t i) const {
+    DCHECK_LT(i, kWidth);
+    return base::bit_cast<F>(values_[i]);
+  }
+
+  bool operator==(const PackedPrimeField31Avx512& other) const {
+    return std::equal(std::begin(values_), std::end(values_),
+                      std::begin(other.values_));
+  }
+  bool operator!=(const PackedPrimeField31Avx512& other) const {
+    return !operator==(other);
+  }
+
+  TACHYON_AVX512F_TARGET PackedPrimeField31Avx512
+  operator+(const PackedPrimeField31Avx512& other) const {
+    return FromVector(internal::prime_field31::avx512::Add(
+        ToVector(), other.ToVector(), GetModulus()));
+  }
+
+  TACHYON_AVX512F_TARGET PackedPrimeField31Avx512
+  operator-(const PackedPrimeField31Avx512& other) const {
+    return FromVector(internal::prime_field31::avx512::Sub(
+        ToVector(), other.ToVector(), GetModulus()));
+  }
+
+  TACHYON_AVX512F_TARGET PackedPrimeField31Avx512 operator-() const {
+    return FromVector(internal::prime_field31::avx512::Sub(
+        _mm512_setzero_si512(), ToVector(), GetModulus()));
+  }
+
+  TACHYON_AVX512F_TARGET PackedPrimeField31Avx512
+  operator*(const PackedPrimeField31Avx512& other) const {
+    return FromVector(Mul(ToVector(), other.ToVector()));
+  }
+
+  PackedPrimeField31Avx512& operator+=(const PackedPrimeField31Avx512& other) {
+    return *this = *this + other;
+  }
+  PackedPrimeField31Avx512& operator-=(const PackedPrimeField31Avx512& other) {
+    return *this = *this - other;
+  }
+  PackedPrimeField31Avx512& operator*=(const PackedPrimeField31Avx512& other) {
+    return *this = *this * other;
+  }
+
+  PackedPrimeField31Avx512 Double() const { return *this + *this; }
+  PackedPrimeField31Avx512 Square() const { return *this * *this; }
+
+  // |a[i]| *= |b[i]|
+  TACHYON_AVX512F_TARGET static void BatchMulInPlace(absl::Span<F> a,
+                                                  absl::Span<const F> b) {
+    CHECK_EQ(a.size(), b.size());
+    size_t size = a.size() - a.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m512i x = LoadVector(&a[i]);
+      __m512i y = LoadVector(&b[i]);
+      StoreVector(Mul(x, y), &a[i]);
+    }
+    for (size_t i = size; i < a.size(); ++i) {
+      a[i] *= b[i];
+    }
+  }
+
+ private:
+  static const uint32_t* ToValues(const F* values) {
+    return reinterpret_cast<const uint32_t*>(values);
+  }
+  static uint32_t* ToValues(F* values) {
+    return reinterpret_cast<uint32_t*>(values);
+  }
+
+  TACHYON_AVX512F_INLINE static __m512i GetModulus() {
+    return _mm512_set1_epi32(F::kModulus);
+  }
+
+  TACHYON_AVX512F_INLINE static __m512i Mul(__m512i a, __m512i b) {
+    if constexpr (F::kModulus == internal::mersenne31::kModulus) {
+      return internal::prime_field31::avx512::MersenneMul(a, b, GetModulus());
+    } else {
+      return internal::prime_field31::avx512::MontMul(
+          a, b, GetModulus(), _mm512_set1_epi32(F::kMu));
+    }
+  }
+
+  TACHYON_AVX512F_INLINE static __m512i LoadVector(const F* values) {
+    return _mm512_loadu_si512(values);
+  }
+
+  TACHYON_AVX512F_INLINE static void StoreVector(__m512i a, F* values) {
+    _mm512_storeu_si512(values, a);
+  }
+
+  TACHYON_AVX512F_INLINE __m512i ToVector() const {
+    return _mm512_loadu_si512(values_);
+  }
+
+  TACHYON_AVX512F_INLINE static PackedPrimeField31Avx512 FromVector(__m512i a) {
+    PackedPrimeField31Avx512 ret;
+    _mm512_storeu_si512(ret.values_, a);
+    return ret;
+  }
+
+  // |values_[i]| is the i-th element in the same form as |F|.
+  uint32_t values_[kWidth] = {};
+};
+
+#endif  // defined(TACHYON_HAS_PACKED_PRIME_FIELD31_AVX512)
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD31_AVX512_H_
@@ -0,0 +1,108 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/koala_bear/koala_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/mersenne31.h"
+#include "tachyon/math/finite_fields/packed_prime_field31_avx2.h"
+#include "tachyon/math/finite_fields/packed_prime_field31_avx512.h"
+
+namespace tachyon::math {
+
+#if defined(TACHYON_HAS_PACKED_PRIME_FIELD31_AVX2) && \
+    defined(TACHYON_HAS_PACKED_PRIME_FIELD31_AVX512)
+
+namespace {
+
+template <typename Packed>
+class PackedPrimeField31Test : public testing::Test {
+ public:
+  using F = typename Packed::F;
+
+  void SetUp() override {
+    if (!Packed::IsAvailable()) {
+      GTEST_SKIP() << "SIMD instructions are not supported";
+    }
+    a_ = base::CreateVector(Packed::kWidth, []() { return F::Random(); });
+    b_ = base::CreateVector(Packed::kWidth, []() { return F::Random(); });
+    // Edge cases.
+    a_[0] = F::Zero();
+    b_[1] = F::Zero();
+    a_[2] = -F::One();
+    b_[2] = -F::One();
+    a_[3] = -F::One();
+    b_[3] = F::One();
+  }
+
+ protected:
+  std::vector<F> a_;
+  std::vector<F> b_;
+};
+
+}  // namespace
+
+using PackedTypes = testing::Types<
+    PackedPrimeField31Avx2<BabyBear>, PackedPrimeField31Avx2<KoalaBear>,
+    PackedPrimeField31Avx2<Mersenne31>, PackedPrimeField31Avx512<BabyBear>,
+    PackedPrimeField31Avx512<KoalaBear>, PackedPrimeField31Avx512<Mersenne31>>;
+TYPED_TEST_SUITE(PackedPrimeField31Test, PackedTypes);
+
+TYPED_TEST(PackedPrimeField31Test, LoadAndStore) {
+  using Packed = TypeParam;
+  using F = typename Packed::F;
+
+  Packed a = Packed::Load(this->a_.data());
+  std::vector<F> stored(Packed::kWidth);
+  a.Store(stored.data());
+  EXPECT_EQ(stored, this->a_);
+
+  F value = F::Random();
+  Packed broadcast = Packed::Broadcast(value);
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    EXPECT_EQ(broadcast[i], value);
+  }
+}
+
+TYPED_TEST(PackedPrimeField31Test, Arithmetics) {
+  using Packed = TypeParam;
+  using F = typename Packed::F;
+
+  Packed a = Packed::Load(this->a_.data());
+  Packed b = Packed::Load(this->b_.data());
+  Packed sum = a + b;
+  Packed diff = a - b;
+  Packed neg = -a;
+  Packed product = a * b;
+  Packed square = a.Square();
+  Packed dbl = a.Double();
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    const F& x = this->a_[i];
+    const F& y = this->b_[i];
+    EXPECT_EQ(sum[i], x + y);
+    EXPECT_EQ(diff[i], x - y);
+    EXPECT_EQ(neg[i], -x);
+    EXPECT_EQ(product[i], x * y);
+    EXPECT_EQ(square[i], x.Square());
+    EXPECT_EQ(dbl[i], x.Double());
+  }
+}
+
+TYPED_TEST(PackedPrimeField31Test, BatchMulInPlace) {
+  using Packed = TypeParam;
+  using F = typename Packed::F;
+
+  for (size_t size : {size_t{0}, size_t{5}, size_t{16}, size_t{37}}) {
+    std::vector<F> a = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> b = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> expected = base::CreateVector(
+        size, [&a, &b](size_t i) { return a[i] * b[i]; });
+    Packed::BatchMulInPlace(absl::MakeSpan(a), b);
+    EXPECT_EQ(a, expected);
+  }
+}
+
+#endif
+
+}  // namespace tachyon::math
@@ -0,0 +1,614 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/finite_fields/finite_field_forwards.h"
+
+#if ARCH_CPU_X86_64 && defined(COMPILER_GCC) && !defined(__CUDA_ARCH__)
+#define TACHYON_HAS_PACKED_PRIME_FIELD_AVX512 1
+#include "tachyon/base/cpu_features.h"
+#include "tachyon/base/x86_intrinsics.h"
+#endif
+
+namespace tachyon::math {
+
+// |PackedPrimeFieldAvx512<F>| holds 8 elements of a prime field |F| and
+// operates on all of them at once with AVX-512 IFMA (VPMADD52LUQ and
+// VPMADD52HUQ). See the definition below for the details.
+template <typename F, typename SFINAE = void>
+class PackedPrimeFieldAvx512;
+
+// True if |PackedPrimeFieldAvx512<F>| is defined. Whether it can be used on
+// the current CPU should be checked by |PackedPrimeFieldAvx512<F>::
+// IsAvailable()| at runtime.
+template <typename F, typename SFINAE = void>
+constexpr bool kCanUsePackedPrimeFieldAvx512 = false;
+
+#if defined(TACHYON_HAS_PACKED_PRIME_FIELD_AVX512)
+
+// Only 4 limbs fields with a spare bit (e.g., bn254, bls12-381 Fr) are
+// supported, since their elements fit in 5 limbs of radix 2⁵².
+template <typename Config>
+constexpr bool kCanUsePackedPrimeFieldAvx512<
+    PrimeField<Config>,
+    std::enable_if_t<!Config::kIsSpecialPrime && Config::kModulusHasSpareBit &&
+                     (Config::kModulusBits + 63) / 64 == 4>> = true;
+
+namespace internal::avx512 {
+
+// True if the CPU supports AVX512F and AVX512_IFMA. This is evaluated once at
+// startup.
+inline const bool kHasAvx512Ifma =
+    base::HasCpuFeature(base::CpuFeature::kAvx512f) &&
+    base::HasCpuFeature(base::CpuFeature::kAvx512Ifma);
+
+constexpr size_t kWidth = 8;
+constexpr size_t kLimbNums = 5;
+constexpr uint64_t kMask52 = (uint64_t{1} << 52) - 1;
+constexpr uint64_t kMask48 = (uint64_t{1} << 48) - 1;
+
+// Converts 4 limbs of radix 2⁶⁴ into 5 limbs of radix 2⁵².
+constexpr std::array<uint64_t, kLimbNums> ToRadix52(const uint64_t in[4]) {
+  return {
+      in[0] & kMask52,
+      ((in[0] >> 52) | (in[1] << 12)) & kMask52,
+      ((in[1] >> 40) | (in[2] << 24)) & kMask52,
+      ((in[2] >> 28) | (in[3] << 36)) & kMask52,
+      in[3] >> 16,
+  };
+}
+
+// Converts 5 limbs of radix 2⁵² into 4 limbs of radix 2⁶⁴.
+constexpr void FromRadix52(const uint64_t in[kLimbNums], uint64_t out[4]) {
+  out[0] = in[0] | (in[1] << 52);
+  out[1] = (in[1] >> 12) | (in[2] << 40);
+  out[2] = (in[2] >> 24) | (in[3] << 28);
+  out[3] = (in[3] >> 36) | (in[4] << 16);
+}
+
+// Converts 8 elements of 4 limbs in radix 2⁶⁴, which are transposed so that
+// |l[i]| holds the i-th limbs, into 5 limbs in radix 2⁵².
+TACHYON_AVX512_IFMA_INLINE void ToRadix52(const __m512i l[4],
+                                          __m512i r[kLimbNums]) {
+  const __m512i mask52 = _mm512_set1_epi64(kMask52);
+  r[0] = _mm512_and_si512(l[0], mask52);
+  r[1] = _mm512_and_si512(
+      _mm512_or_si512(_mm512_srli_epi64(l[0], 52), _mm512_slli_epi64(l[1], 12)),
+      mask52);
+  r[2] = _mm512_and_si512(
+      _mm512_or_si512(_mm512_srli_epi64(l[1], 40), _mm512_slli_epi64(l[2], 24)),
+      mask52);
+  r[3] = _mm512_and_si512(
+      _mm512_or_si512(_mm512_srli_epi64(l[2], 28), _mm512_slli_epi64(l[3], 36)),
+      mask52);
+  r[4] = _mm512_srli_epi64(l[3], 16);
+}
+
+// The inverse of |ToRadix52()|.
+TACHYON_AVX512_IFMA_INLINE void FromRadix52(const __m512i a[kLimbNums],
+                                            __m512i l[4]) {
+  l[0] = _mm512_or_si512(a[0], _mm512_slli_epi64(a[1], 52));
+  l[1] = _mm512_or_si512(_mm512_srli_epi64(a[1], 12),
+                         _mm512_slli_epi64(a[2], 40));
+  l[2] = _mm512_or_si512(_mm512_srli_epi64(a[2], 24),
+                         _mm512_slli_epi64(a[3], 28));
+  l[3] = _mm512_or_si512(_mm512_srli_epi64(a[3], 36),
+                         _mm512_slli_epi64(a[4], 16));
+}
+
+// Permutation indices for |Transpose()| and |Untranspose()|.
+TACHYON_AVX512_IFMA_INLINE void GetTransposeIndices(__m512i indices[4]) {
+  // [0, 4, 8, 12, 1, 5, 9, 13]
+  indices[0] = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+  // [2, 6, 10, 14, 3, 7, 11, 15]
+  indices[1] = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+  // [0, 1, 2, 3, 8, 9, 10, 11]
+  indices[2] = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+  // [4, 5, 6, 7, 12, 13, 14, 15]
+  indices[3] = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+}
+
+// Transposes 8 elements of 4 limbs, where |in[0]| = [x₀, x₁],
+// |in[1]| = [x₂, x₃], |in[2]| = [x₄, x₅] and |in[3]| = [x₆, x₇], so that
+// |out[i]| = [x₀[i], x₁[i], ..., x₇[i]].
+TACHYON_AVX512_IFMA_INLINE void Transpose(const __m512i in[4],
+                                          __m512i out[4]) {
+  __m512i indices[4];
+  GetTransposeIndices(indices);
+  __m512i t[4];
+  t[0] = _mm512_permutex2var_epi64(in[0], indices[0], in[1]);
+  t[1] = _mm512_permutex2var_epi64(in[0], indices[1], in[1]);
+  t[2] = _mm512_permutex2var_epi64(in[2], indices[0], in[3]);
+  t[3] = _mm512_permutex2var_epi64(in[2], indices[1], in[3]);
+  out[0] = _mm512_permutex2var_epi64(t[0], indices[2], t[2]);
+  out[1] = _mm512_permutex2var_epi64(t[0], indices[3], t[2]);
+  out[2] = _mm512_permutex2var_epi64(t[1], indices[2], t[3]);
+  out[3] = _mm512_permutex2var_epi64(t[1], indices[3], t[3]);
+}
+
+// The inverse of |Transpose()|.
+TACHYON_AVX512_IFMA_INLINE void Untranspose(const __m512i in[4],
+                                            __m512i out[4]) {
+  __m512i indices[4];
+  GetTransposeIndices(indices);
+  __m512i t[4];
+  t[0] = _mm512_permutex2var_epi64(in[0], indices[2], in[1]);
+  t[1] = _mm512_permutex2var_epi64(in[2], indices[2], in[3]);
+  t[2] = _mm512_permutex2var_epi64(in[0], indices[3], in[1]);
+  t[3] = _mm512_permutex2var_epi64(in[2], indices[3], in[3]);
+  out[0] = _mm512_permutex2var_epi64(t[0], indices[0], t[1]);
+  out[1] = _mm512_permutex2var_epi64(t[0], indices[1], t[1]);
+  out[2] = _mm512_permutex2var_epi64(t[2], indices[0], t[3]);
+  out[3] = _mm512_permutex2var_epi64(t[2], indices[1], t[3]);
+}
+
+// Loads 8 consecutive elements of 4 limbs in radix 2⁶⁴ at |ptr| and converts
+// them into radix 2⁵².
+TACHYON_AVX512_IFMA_INLINE void Load(const uint64_t* ptr,
+                                     __m512i r[kLimbNums]) {
+  __m512i in[4], l[4];
+#pragma GCC unroll 6
+  for (size_t i = 0; i < 4; ++i) {
+    in[i] = _mm512_loadu_si512(ptr + 8 * i);
+  }
+  Transpose(in, l);
+  ToRadix52(l, r);
+}
+
+// Same as |Load()|, but the elements are |stride| elements apart.
+TACHYON_AVX512_IFMA_INLINE void LoadStrided(const uint64_t* ptr, size_t stride,
+                                            __m512i r[kLimbNums]) {
+  const long long s = static_cast<long long>(4 * stride);
+  const __m512i index =
+      _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+  __m512i l[4];
+#pragma GCC unroll 6
+  for (size_t i = 0; i < 4; ++i) {
+    l[i] = _mm512_i64gather_epi64(index, ptr + i, 8);
+  }
+  ToRadix52(l, r);
+}
+
+// The inverse of |Load()|.
+TACHYON_AVX512_IFMA_INLINE void Store(const __m512i a[kLimbNums],
+                                      uint64_t* ptr) {
+  __m512i l[4], out[4];
+  FromRadix52(a, l);
+  Untranspose(l, out);
+#pragma GCC unroll 6
+  for (size_t i = 0; i < 4; ++i) {
+    _mm512_storeu_si512(ptr + 8 * i, out[i]);
+  }
+}
+
+// Subtracts |p| from |a| if |a| >= |p|. |a| must be less than 2 * |p|.
+TACHYON_AVX512_IFMA_INLINE void ReduceOnce(__m512i a[kLimbNums],
+                                           const __m512i p[kLimbNums]) {
+  const __m512i mask52 = _mm512_set1_epi64(kMask52);
+  __m512i d[kLimbNums];
+  __m512i borrow = _mm512_setzero_si512();
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    d[i] = _mm512_add_epi64(_mm512_sub_epi64(a[i], p[i]), borrow);
+    if (i != kLimbNums - 1) {
+      borrow = _mm512_srai_epi64(d[i], 52);
+      d[i] = _mm512_and_si512(d[i], mask52);
+    }
+  }
+  __mmask8 lt =
+      _mm512_cmplt_epi64_mask(d[kLimbNums - 1], _mm512_setzero_si512());
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    a[i] = _mm512_mask_blend_epi64(lt, d[i], a[i]);
+  }
+}
+
+// |r| = |a| + |b| mod |p|
+TACHYON_AVX512_IFMA_INLINE void Add(const __m512i a[kLimbNums],
+                                    const __m512i b[kLimbNums],
+                                    const __m512i p[kLimbNums],
+                                    __m512i r[kLimbNums]) {
+  const __m512i mask52 = _mm512_set1_epi64(kMask52);
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    r[i] = _mm512_add_epi64(a[i], b[i]);
+  }
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums - 1; ++i) {
+    r[i + 1] = _mm512_add_epi64(r[i + 1], _mm512_srli_epi64(r[i], 52));
+    r[i] = _mm512_and_si512(r[i], mask52);
+  }
+  ReduceOnce(r, p);
+}
+
+// |r| = |a| - |b| mod |p|
+TACHYON_AVX512_IFMA_INLINE void Sub(const __m512i a[kLimbNums],
+                                    const __m512i b[kLimbNums],
+                                    const __m512i p[kLimbNums],
+                                    __m512i r[kLimbNums]) {
+  const __m512i mask52 = _mm512_set1_epi64(kMask52);
+  __m512i borrow = _mm512_setzero_si512();
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    r[i] = _mm512_add_epi64(_mm512_sub_epi64(a[i], b[i]), borrow);
+    if (i != kLimbNums - 1) {
+      borrow = _mm512_srai_epi64(r[i], 52);
+      r[i] = _mm512_and_si512(r[i], mask52);
+    }
+  }
+  // Adds |p| back to the lanes that went below zero.
+  __mmask8 lt =
+      _mm512_cmplt_epi64_mask(r[kLimbNums - 1], _mm512_setzero_si512());
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    r[i] = _mm512_mask_add_epi64(r[i], lt, r[i], p[i]);
+  }
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums - 1; ++i) {
+    r[i + 1] = _mm512_add_epi64(r[i + 1], _mm512_srli_epi64(r[i], 52));
+    r[i] = _mm512_and_si512(r[i], mask52);
+  }
+}
+
+// |r| = |a| * |b| * 2⁻²⁵⁶ mod |p|, where |inv| = -|p|⁻¹ mod 2⁵².
+//
+// This is the CIOS montgomery multiplication in radix 2⁵². The accumulators
+// are 64 bits wide, so the carries are propagated only once at the end. The
+// first 4 rounds reduce 52 bits each and the last round reduces 48 bits, so
+// that the montgomery radix is 2²⁵⁶ like |PrimeField<F>| instead of 2²⁶⁰. As a
+// result, no conversion is needed other than repacking the limbs.
+TACHYON_AVX512_IFMA_INLINE void MontMul(const __m512i a[kLimbNums],
+                                        const __m512i b[kLimbNums],
+                                        const __m512i p[kLimbNums],
+                                        __m512i inv, __m512i r[kLimbNums]) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i mask52 = _mm512_set1_epi64(kMask52);
+  __m512i t[kLimbNums + 1];
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums + 1; ++i) {
+    t[i] = zero;
+  }
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+#pragma GCC unroll 6
+    for (size_t j = 0; j < kLimbNums; ++j) {
+      t[j] = _mm512_madd52lo_epu64(t[j], a[j], b[i]);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[j], b[i]);
+    }
+    __m512i m = _mm512_madd52lo_epu64(zero, t[0], inv);
+    if (i == kLimbNums - 1) {
+      m = _mm512_and_si512(m, _mm512_set1_epi64(kMask48));
+    }
+#pragma GCC unroll 6
+    for (size_t j = 0; j < kLimbNums; ++j) {
+      t[j] = _mm512_madd52lo_epu64(t[j], p[j], m);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], p[j], m);
+    }
+    if (i != kLimbNums - 1) {
+      // The lowest 52 bits of |t[0]| are zero now.
+      t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+#pragma GCC unroll 6
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        t[j] = t[j + 1];
+      }
+      t[kLimbNums] = zero;
+    }
+  }
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+    t[i] = _mm512_and_si512(t[i], mask52);
+  }
+  // The lowest 48 bits of |t[0]| are zero now.
+#pragma GCC unroll 6
+  for (size_t i = 0; i < kLimbNums; ++i) {
+    r[i] = _mm512_or_si512(
+        _mm512_srli_epi64(t[i], 48),
+        _mm512_and_si512(_mm512_slli_epi64(t[i + 1], 4), mask52));
+  }
+  ReduceOnce(r, p);
+}
+
+}  // namespace internal::avx512
+
+// |PackedPrimeFieldAvx512<F>| keeps 8 elements in radix 2⁵², transposed so
+// that the i-th limbs of all the elements share an AVX-512 register. The
+// elements stay in the montgomery form of |F|, which means packing and
+// unpacking only repack the limbs. The elements are always fully reduced.
+//
+// All the methods require AVX512F and AVX512_IFMA, so they must not be called
+// unless |IsAvailable()| returns true. The batch methods handle the
+// remainders that don't fill 8 lanes with |F|.
+template <typename F>
+class PackedPrimeFieldAvx512<
+    F, std::enable_if_t<kCanUsePackedPrimeFieldAvx512<F>>>
+    final {
+ public:
+  constexpr static size_t kWidth = internal::avx512::kWidth;
+  constexpr static size_t kLimbNums = internal::avx512::kLimbNums;
+
+  static_assert(sizeof(F) == sizeof(uint64_t) * 4,
+                "F should consist of 4 limbs only");
+
+  PackedPrimeFieldAvx512() = default;
+
+  static bool IsAvailable() { return internal::avx512::kHasAvx512Ifma; }
+
+  static PackedPrimeFieldAvx512 Zero() { return PackedPrimeFieldAvx512(); }
+
+  static PackedPrimeFieldAvx512 Broadcast(const F& value) {
+    std::array<uint64_t, kLimbNums> limbs =
+        internal::avx512::ToRadix52(value.ToMontgomery().limbs);
+    PackedPrimeFieldAvx512 ret;
+#pragma GCC unroll 6
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      std::fill(std::begin(ret.limbs_[i]), std::end(ret.limbs_[i]), limbs[i]);
+    }
+    return ret;
+  }
+
+  // Loads |values[0]|, ..., |values[7]|.
+  TACHYON_AVX512_IFMA_TARGET static PackedPrimeFieldAvx512 Load(
+      const F* values) {
+    __m512i a[kLimbNums];
+    internal::avx512::Load(ToLimbs(values), a);
+    return FromVectors(a);
+  }
+
+  // Stores the elements to |values[0]|, ..., |values[7]|.
+  TACHYON_AVX512_IFMA_TARGET void Store(F* values) const {
+    __m512i a[kLimbNums];
+    ToVectors(a);
+    internal::avx512::Store(a, ToLimbs(values));
+  }
+
+  F operator[](size_t i) const {
+    DCHECK_LT(i, kWidth);
+    uint64_t limbs[kLimbNums];
+#pragma GCC unroll 6
+    for (size_t j = 0; j < kLimbNums; ++j) {
+      limbs[j] = limbs_[j][i];
+    }
+    typename F::BigIntTy value;
+    internal::avx512::FromRadix52(limbs, value.limbs);
+    return F::FromMontgomery(value);
+  }
+
+  bool operator==(const PackedPrimeFieldAvx512& other) const {
+    return std::equal(&limbs_[0][0], &limbs_[0][0] + kLimbNums * kWidth,
+                      &other.limbs_[0][0]);
+  }
+  bool operator!=(const PackedPrimeFieldAvx512& other) const {
+    return !operator==(other);
+  }
+
+  TACHYON_AVX512_IFMA_TARGET PackedPrimeFieldAvx512
+  operator+(const PackedPrimeFieldAvx512& other) const {
+    __m512i a[kLimbNums], b[kLimbNums], p[kLimbNums], r[kLimbNums];
+    ToVectors(a);
+    other.ToVectors(b);
+    GetModulus(p);
+    internal::avx512::Add(a, b, p, r);
+    return FromVectors(r);
+  }
+
+  TACHYON_AVX512_IFMA_TARGET PackedPrimeFieldAvx512
+  operator-(const PackedPrimeFieldAvx512& other) const {
+    __m512i a[kLimbNums], b[kLimbNums], p[kLimbNums], r[kLimbNums];
+    ToVectors(a);
+    other.ToVectors(b);
+    GetModulus(p);
+    internal::avx512::Sub(a, b, p, r);
+    return FromVectors(r);
+  }
+
+  TACHYON_AVX512_IFMA_TARGET PackedPrimeFieldAvx512 operator-() const {
+    return Zero() - *this;
+  }
+
+  TACHYON_AVX512_IFMA_TARGET PackedPrimeFieldAvx512
+  operator*(const PackedPrimeFieldAvx512& other) const {
+    __m512i a[kLimbNums], b[kLimbNums], p[kLimbNums], r[kLimbNums];
+    ToVectors(a);
+    other.ToVectors(b);
+    GetModulus(p);
+    internal::avx512::MontMul(a, b, p, GetInverse(), r);
+    return FromVectors(r);
+  }
+
+  PackedPrimeFieldAvx512& operator+=(const PackedPrimeFieldAvx512& other) {
+    return *this = *this + other;
+  }
+  PackedPrimeFieldAvx512& operator-=(const PackedPrimeFieldAvx512& other) {
+    return *this = *this - other;
+  }
+  PackedPrimeFieldAvx512& operator*=(const PackedPrimeFieldAvx512& other) {
+    return *this = *this * other;
+  }
+
+  PackedPrimeFieldAvx512 Double() const { return *this + *this; }
+  PackedPrimeFieldAvx512 Square() const { return *this * *this; }
+
+  // |a[i]| *= |b[i]|
+  TACHYON_AVX512_IFMA_TARGET static void BatchMulInPlace(
+      absl::Span<F> a, absl::Span<const F> b) {
+    CHECK_EQ(a.size(), b.size());
+    __m512i p[kLimbNums];
+    GetModulus(p);
+    __m512i inv = GetInverse();
+    size_t size = a.size() - a.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m512i x[kLimbNums], y[kLimbNums];
+      internal::avx512::Load(ToLimbs(&a[i]), x);
+      internal::avx512::Load(ToLimbs(&b[i]), y);
+      internal::avx512::MontMul(x, y, p, inv, x);
+      internal::avx512::Store(x, ToLimbs(&a[i]));
+    }
+    for (size_t i = size; i < a.size(); ++i) {
+      a[i] *= b[i];
+    }
+  }
+
+  // |a[i]| *= |c| * |g|ⁱ
+  TACHYON_AVX512_IFMA_TARGET static void BatchDistributePowers(
+      absl::Span<F> a, const F& c, const F& g) {
+    F pows[kWidth];
+    pows[0] = c;
+    for (size_t i = 1; i < kWidth; ++i) {
+      pows[i] = pows[i - 1] * g;
+    }
+    F g8 = g.Square().Square().Square();
+
+    __m512i p[kLimbNums];
+    GetModulus(p);
+    __m512i inv = GetInverse();
+    __m512i pow[kLimbNums], step[kLimbNums];
+    internal::avx512::Load(ToLimbs(pows), pow);
+    Broadcast(g8).ToVectors(step);
+    size_t size = a.size() - a.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m512i x[kLimbNums];
+      internal::avx512::Load(ToLimbs(&a[i]), x);
+      internal::avx512::MontMul(x, pow, p, inv, x);
+      internal::avx512::Store(x, ToLimbs(&a[i]));
+      internal::avx512::MontMul(pow, step, p, inv, pow);
+    }
+    if (size == a.size()) return;
+    internal::avx512::Store(pow, ToLimbs(pows));
+    F remainder_pow = pows[0];
+    for (size_t i = size; i < a.size(); ++i) {
+      a[i] *= remainder_pow;
+      remainder_pow *= g;
+    }
+  }
+
+  // Applies the butterfly of |UnivariateEvaluationDomain<F>::
+  // ButterflyFnInOut()| to (|lo[i]|, |hi[i]|, |roots[i * step]|).
+  TACHYON_AVX512_IFMA_TARGET static void BatchButterflyInOut(
+      absl::Span<F> lo, absl::Span<F> hi, const F* roots, size_t step) {
+    CHECK_EQ(lo.size(), hi.size());
+    __m512i p[kLimbNums];
+    GetModulus(p);
+    __m512i inv = GetInverse();
+    size_t size = lo.size() - lo.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m512i x[kLimbNums], y[kLimbNums], w[kLimbNums], neg[kLimbNums];
+      internal::avx512::Load(ToLimbs(&lo[i]), x);
+      internal::avx512::Load(ToLimbs(&hi[i]), y);
+      LoadRoots(&roots[i * step], step, w);
+      internal::avx512::Sub(x, y, p, neg);
+      internal::avx512::Add(x, y, p, x);
+      internal::avx512::MontMul(neg, w, p, inv, y);
+      internal::avx512::Store(x, ToLimbs(&lo[i]));
+      internal::avx512::Store(y, ToLimbs(&hi[i]));
+    }
+    for (size_t i = size; i < lo.size(); ++i) {
+      F neg = lo[i] - hi[i];
+      lo[i] += hi[i];
+      hi[i] = neg * roots[i * step];
+    }
+  }
+
+  // Applies the butterfly of |UnivariateEvaluationDomain<F>::
+  // ButterflyFnOutIn()| to (|lo[i]|, |hi[i]|, |roots[i * step]|).
+  TACHYON_AVX512_IFMA_TARGET static void BatchButterflyOutIn(
+      absl::Span<F> lo, absl::Span<F> hi, const F* roots, size_t step) {
+    CHECK_EQ(lo.size(), hi.size());
+    __m512i p[kLimbNums];
+    GetModulus(p);
+    __m512i inv = GetInverse();
+    size_t size = lo.size() - lo.size() % kWidth;
+    for (size_t i = 0; i < size; i += kWidth) {
+      __m512i x[kLimbNums], y[kLimbNums], w[kLimbNums];
+      internal::avx512::Load(ToLimbs(&lo[i]), x);
+      internal::avx512::Load(ToLimbs(&hi[i]), y);
+      LoadRoots(&roots[i * step], step, w);
+      internal::avx512::MontMul(y, w, p, inv, y);
+      internal::avx512::Sub(x, y, p, w);
+      internal::avx512::Add(x, y, p, x);
+      internal::avx512::Store(x, ToLimbs(&lo[i]));
+      internal::avx512::Store(w, ToLimbs(&hi[i]));
+    }
+    for (size_t i = size; i < lo.size(); ++i) {
+      hi[i] *= roots[i * step];
+      F neg = lo[i] - hi[i];
+      lo[i] += hi[i];
+      hi[i] = neg;
+    }
+  }
+
+ private:
+  using Config = typename F::Config;
+
+  constexpr static std::array<uint64_t, kLimbNums> kModulus =
+      internal::avx512::ToRadix52(Config::kModulus.limbs);
+  // -|p|⁻¹ mod 2⁵²
+  constexpr static uint64_t kInverse =
+      Config::kInverse64 & internal::avx512::kMask52;
+
+  static const uint64_t* ToLimbs(const F* values) {
+    return reinterpret_cast<const uint64_t*>(values);
+  }
+  static uint64_t* ToLimbs(F* values) {
+    return reinterpret_cast<uint64_t*>(values);
+  }
+
+  TACHYON_AVX512_IFMA_INLINE static void GetModulus(__m512i p[kLimbNums]) {
+#pragma GCC unroll 6
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      p[i] = _mm512_set1_epi64(kModulus[i]);
+    }
+  }
+
+  TACHYON_AVX512_IFMA_INLINE static __m512i GetInverse() {
+    return _mm512_set1_epi64(kInverse);
+  }
+
+  TACHYON_AVX512_IFMA_INLINE static void LoadRoots(const F* roots, size_t step,
+                                                   __m512i w[kLimbNums]) {
+    if (step == 1) {
+      internal::avx512::Load(ToLimbs(roots), w);
+    } else {
+      internal::avx512::LoadStrided(ToLimbs(roots), step, w);
+    }
+  }
+
+  TACHYON_AVX512_IFMA_INLINE void ToVectors(__m512i a[kLimbNums]) const {
+#pragma GCC unroll 6
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      a[i] = _mm512_loadu_si512(limbs_[i]);
+    }
+  }
+
+  TACHYON_AVX512_IFMA_INLINE static PackedPrimeFieldAvx512
+  FromVectors(const __m512i a[kLimbNums]) {
+    PackedPrimeFieldAvx512 ret;
+#pragma GCC unroll 6
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      _mm512_storeu_si512(ret.limbs_[i], a[i]);
+    }
+    return ret;
+  }
+
+  // |limbs_[i][j]| is the i-th limb of the j-th element in radix 2⁵².
+  // NOTE: This is intentionally not aligned to 64 bytes, since GCC doesn't
+  // always honor the alignment of the temporaries in the functions compiled
+  // without AVX-512.
+  uint64_t limbs_[kLimbNums][kWidth] = {};
+};
+
+#endif  // defined(TACHYON_HAS_PACKED_PRIME_FIELD_AVX512)
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_H_
@@ -0,0 +1,169 @@
+#include "tachyon/math/finite_fields/packed_prime_field_avx512.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::math {
+
+#if defined(TACHYON_HAS_PACKED_PRIME_FIELD_AVX512)
+
+namespace {
+
+template <typename F>
+class PackedPrimeFieldAvx512Test : public testing::Test {
+ public:
+  using Packed = PackedPrimeFieldAvx512<F>;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    if (!Packed::IsAvailable()) {
+      GTEST_SKIP() << "AVX512F and AVX512_IFMA are not supported";
+    }
+    a_ = base::CreateVector(Packed::kWidth, []() { return F::Random(); });
+    b_ = base::CreateVector(Packed::kWidth, []() { return F::Random(); });
+    // Edge cases.
+    a_[0] = F::Zero();
+    b_[1] = F::Zero();
+    a_[2] = -F::One();
+    b_[2] = -F::One();
+    a_[3] = F::One();
+  }
+
+ protected:
+  std::vector<F> a_;
+  std::vector<F> b_;
+};
+
+}  // namespace
+
+using PrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr, bls12_381::Fr>;
+TYPED_TEST_SUITE(PackedPrimeFieldAvx512Test, PrimeFieldTypes);
+
+TYPED_TEST(PackedPrimeFieldAvx512Test, LoadAndStore) {
+  using F = TypeParam;
+  using Packed = PackedPrimeFieldAvx512<F>;
+
+  Packed a = Packed::Load(this->a_.data());
+  std::vector<F> stored(Packed::kWidth);
+  a.Store(stored.data());
+  EXPECT_EQ(stored, this->a_);
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    EXPECT_EQ(a[i], this->a_[i]);
+  }
+
+  F value = F::Random();
+  Packed broadcast = Packed::Broadcast(value);
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    EXPECT_EQ(broadcast[i], value);
+  }
+}
+
+TYPED_TEST(PackedPrimeFieldAvx512Test, Arithmetics) {
+  using F = TypeParam;
+  using Packed = PackedPrimeFieldAvx512<F>;
+
+  Packed a = Packed::Load(this->a_.data());
+  Packed b = Packed::Load(this->b_.data());
+  Packed sum = a + b;
+  Packed diff = a - b;
+  Packed neg = -a;
+  Packed product = a * b;
+  Packed square = a.Square();
+  Packed dbl = a.Double();
+  for (size_t i = 0; i < Packed::kWidth; ++i) {
+    const F& x = this->a_[i];
+    const F& y = this->b_[i];
+    EXPECT_EQ(sum[i], x + y);
+    EXPECT_EQ(diff[i], x - y);
+    EXPECT_EQ(neg[i], -x);
+    EXPECT_EQ(product[i], x * y);
+    EXPECT_EQ(square[i], x.Square());
+    EXPECT_EQ(dbl[i], x.Double());
+  }
+}
+
+TYPED_TEST(PackedPrimeFieldAvx512Test, BatchMulInPlace) {
+  using F = TypeParam;
+  using Packed = PackedPrimeFieldAvx512<F>;
+
+  for (size_t size : {size_t{0}, size_t{5}, size_t{8}, size_t{27}}) {
+    std::vector<F> a = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> b = base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> expected = base::CreateVector(
+        size, [&a, &b](size_t i) { return a[i] * b[i]; });
+    Packed::BatchMulInPlace(absl::MakeSpan(a), b);
+    EXPECT_EQ(a, expected);
+  }
+}
+
+TYPED_TEST(PackedPrimeFieldAvx512Test, BatchDistributePowers) {
+  using F = TypeParam;
+  using Packed = PackedPrimeFieldAvx512<F>;
+
+  F c = F::Random();
+  F g = F::Random();
+  for (size_t size : {size_t{0}, size_t{5}, size_t{8}, size_t{27}}) {
+    std::vector<F> a = base::CreateVector(size, []() { return F::Random(); });
+    F pow = c;
+    std::vector<F> expected = base::CreateVector(size, [&a, &pow, &g](size_t i) {
+      F ret = a[i] * pow;
+      pow *= g;
+      return ret;
+    });
+    Packed::BatchDistributePowers(absl::MakeSpan(a), c, g);
+    EXPECT_EQ(a, expected);
+  }
+}
+
+TYPED_TEST(PackedPrimeFieldAvx512Test, BatchButterfly) {
+  using F = TypeParam;
+  using Packed = PackedPrimeFieldAvx512<F>;
+
+  constexpr size_t kSize = 19;
+  for (size_t step : {size_t{1}, size_t{3}}) {
+    std::vector<F> roots =
+        base::CreateVector(kSize * step, []() { return F::Random(); });
+    std::vector<F> lo = base::CreateVector(kSize, []() { return F::Random(); });
+    std::vector<F> hi = base::CreateVector(kSize, []() { return F::Random(); });
+
+    std::vector<F> expected_lo = lo;
+    std::vector<F> expected_hi = hi;
+    for (size_t i = 0; i < kSize; ++i) {
+      F neg = expected_lo[i] - expected_hi[i];
+      expected_lo[i] += expected_hi[i];
+      expected_hi[i] = neg * roots[i * step];
+    }
+    std::vector<F> actual_lo = lo;
+    std::vector<F> actual_hi = hi;
+    Packed::BatchButterflyInOut(absl::MakeSpan(actual_lo),
+                                absl::MakeSpan(actual_hi), roots.data(), step);
+    EXPECT_EQ(actual_lo, expected_lo);
+    EXPECT_EQ(actual_hi, expected_hi);
+
+    expected_lo = lo;
+    expected_hi = hi;
+    for (size_t i = 0; i < kSize; ++i) {
+      expected_hi[i] *= roots[i * step];
+      F neg = expected_lo[i] - expected_hi[i];
+      expected_lo[i] += expected_hi[i];
+      expected_hi[i] = neg;
+    }
+    actual_lo = lo;
+    actual_hi = hi;
+    Packed::BatchButterflyOutIn(absl::MakeSpan(actual_lo),
+                                absl::MakeSpan(actual_hi), roots.data(), step);
+    EXPECT_EQ(actual_lo, expected_lo);
+    EXPECT_EQ(actual_hi, expected_hi);
+  }
+}
+
+#endif  // defined(TACHYON_HAS_PACKED_PRIME_FIELD_AVX512)
+
+}  // namespace tachyon::math
@@ -13,12 +13,20 @@
 
 #include "gtest/gtest_prod.h"
 
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
+#include "tachyon/build/build_config.h"
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/base/safe_gcd.h"
 #include "tachyon/math/finite_fields/modulus.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
+#if ARCH_CPU_X86_64 && defined(COMPILER_GCC) && !defined(__CUDA_ARCH__)
+#define TACHYON_HAS_PRIME_FIELD_X86_64_ASM 1
+#include "tachyon/math/finite_fields/prime_field_x86_64.h"
+#endif
+
 namespace tachyon::math {
 
 template <typename Config>
@@ -192,6 +200,7 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   // TODO(chokobole): Support bigendian.
   // MultiplicativeSemigroup methods
   constexpr PrimeField& MulInPlace(const PrimeField& other) {
+    if (AsmMulInPlace(other)) return *this;
     if constexpr (Config::kCanUseNoCarryMulOptimization) {
       return FastMulInPlace(other);
     } else {
@@ -200,6 +209,7 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   }
 
   constexpr PrimeField& SquareInPlace() {
+    if (AsmMulInPlace(*this)) return *this;
     if (N == 1) {
       return MulInPlace(*this);
     }
@@ -242,15 +252,114 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   }
 
   constexpr PrimeField& InverseInPlace() {
-    value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
-        Config::kModulus, Config::kMontgomeryR2);
+    if (base::is_constant_evaluated()) {
+      value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
+          Config::kModulus, Config::kMontgomeryR2);
+    } else {
+      value_ = kSafeGcd.Inverse(value_, Config::kMontgomeryR2);
+    }
     return *this;
   }
 
+  // Lazy reduction methods
+  // |UnreducedTy| holds a product of two elements in the montgomery form
+  // before the montgomery reduction, i.e., aR * bR. The sums and the
+  // differences of the products are kept in [0, p * R) by subtracting or
+  // adding p * R, so that any combination of them is turned into an element by
+  // a single |FromUnreduced()|. This lets the extension fields reduce once per
+  // output coefficient instead of once per product.
+  using UnreducedTy = BigInt<2 * N>;
+
+  constexpr UnreducedTy MulUnreduced(const PrimeField& other) const {
+#if defined(TACHYON_HAS_PRIME_FIELD_X86_64_ASM)
+    if constexpr (Config::kModulusHasSpareBit &&
+                  internal::x86_64::kHasMontMul<N>) {
+      if (!base::is_constant_evaluated() && internal::x86_64::kHasBmi2AndAdx) {
+        UnreducedTy ret;
+        internal::x86_64::MulWide<N>(ret.limbs, value_.limbs,
+                                     other.value_.limbs);
+        return ret;
+      }
+    }
+#endif
+    return value_.Mul(other.value_);
+  }
+
+  // |a| = |a| + |b| mod p * R
+  constexpr static void AddUnreducedInPlace(UnreducedTy* a,
+                                            const UnreducedTy& b) {
+    uint64_t carry = 0;
+    a->AddInPlace(b, carry);
+    if (carry || *a >= kModulusTimesR) {
+      a->SubInPlace(kModulusTimesR);
+    }
+  }
+
+  // |a| = |a| - |b| mod p * R
+  constexpr static void SubUnreducedInPlace(UnreducedTy* a,
+                                            const UnreducedTy& b) {
+    uint64_t borrow = 0;
+    a->SubInPlace(b, borrow);
+    if (borrow) {
+      a->AddInPlace(kModulusTimesR);
+    }
+  }
+
+  constexpr static PrimeField FromUnreduced(const UnreducedTy& unreduced) {
+    PrimeField ret;
+#if defined(TACHYON_HAS_PRIME_FIELD_X86_64_ASM)
+    if constexpr (Config::kModulusHasSpareBit &&
+                  internal::x86_64::kHasMontMul<N>) {
+      if (!base::is_constant_evaluated() && internal::x86_64::kHasBmi2AndAdx) {
+        internal::x86_64::MontReduce<N>(ret.value_.limbs, unreduced.limbs,
+                                        Config::kModulus.limbs,
+                                        Config::kInverse64);
+        return ret;
+      }
+    }
+#endif
+    UnreducedTy r = unreduced;
+    BigInt<N>::template MontgomeryReduce64<Config::kModulusHasSpareBit>(
+        r, Config::kModulus, Config::kInverse64, &ret.value_);
+    return ret;
+  }
+
  private:
+  // Used to compute the inverse at runtime. See |InverseInPlace()|.
+  constexpr static SafeGcd<N> kSafeGcd = SafeGcd<N>(Config::kModulus);
+
+  constexpr static UnreducedTy ComputeModulusTimesR() {
+    UnreducedTy ret;
+    for (size_t i = 0; i < N; ++i) {
+      ret[N + i] = Config::kModulus[i];
+    }
+    return ret;
+  }
+
+  // p * R, which is the upper bound of |UnreducedTy|.
+  constexpr static UnreducedTy kModulusTimesR = ComputeModulusTimesR();
+
   template <typename PrimeFieldType>
   FRIEND_TEST(PrimeFieldCorrectnessTest, MultiplicativeOperators);
 
+  // Multiplies with the MULX/ADCX/ADOX kernel if the CPU supports it and
+  // returns true. Otherwise, returns false and the portable implementation
+  // should be used instead.
+  constexpr bool AsmMulInPlace(const PrimeField& other) {
+#if defined(TACHYON_HAS_PRIME_FIELD_X86_64_ASM)
+    if constexpr (Config::kModulusHasSpareBit &&
+                  internal::x86_64::kHasMontMul<N>) {
+      if (!base::is_constant_evaluated() && internal::x86_64::kHasBmi2AndAdx) {
+        internal::x86_64::MontMul<N>(value_.limbs, other.value_.limbs,
+                                     Config::kModulus.limbs,
+                                     Config::kInverse64);
+        return true;
+      }
+    }
+#endif
+    return false;
+  }
+
   constexpr PrimeField& FastMulInPlace(const PrimeField& other) {
     BigInt<N> r;
     for (size_t i = 0; i < N; ++i) {
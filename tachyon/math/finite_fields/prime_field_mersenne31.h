@@ -0,0 +1,220 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MERSENNE31_H_
+#define TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MERSENNE31_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/prime_field_base.h"
+#include "tachyon/math/finite_fields/prime_field_mont31.h"
+
+namespace tachyon::math {
+namespace internal::mersenne31 {
+
+// p = 2³¹ - 1
+constexpr uint32_t kModulus = (uint32_t{1} << 31) - 1;
+
+// Returns |x| mod p for |x| in [0, 2⁶²).
+//
+// Let |x| = x₁ * 2³¹ + x₀. Since 2³¹ ≡ 1 (mod p), |x| ≡ x₁ + x₀ (mod p).
+constexpr uint32_t Reduce(uint64_t x) {
+  // This never overflows since x₁ < 2³¹ and x₀ < 2³¹.
+  uint32_t r = static_cast<uint32_t>(x & kModulus) +
+               static_cast<uint32_t>(x >> 31);
+  uint32_t t = r - kModulus;
+  return t < r ? t : r;
+}
+
+// Returns |a| * |b| mod p.
+constexpr uint32_t Mul(uint32_t a, uint32_t b) {
+  return Reduce(uint64_t{a} * b);
+}
+
+}  // namespace internal::mersenne31
+
+// A prime field for p = 2³¹ - 1, which is known as Mersenne31. The elements
+// are kept in the canonical form in a single 32-bit word, and the
+// multiplication is reduced with the special form of p.
+template <typename _Config>
+class PrimeField<_Config, std::enable_if_t<_Config::kIsMersenne31>> final
+    : public PrimeFieldBase<PrimeField<_Config>> {
+ public:
+  constexpr static size_t kModulusBits = _Config::kModulusBits;
+  constexpr static size_t kLimbNums = 1;
+  constexpr static size_t N = kLimbNums;
+
+  using Config = _Config;
+  using BigIntTy = BigInt<N>;
+  using MontgomeryTy = BigInt<N>;
+  using value_type = uint32_t;
+
+  static_assert(Config::kModulus[0] == internal::mersenne31::kModulus);
+
+  constexpr static uint32_t kModulus = internal::mersenne31::kModulus;
+
+  constexpr PrimeField() = default;
+  constexpr explicit PrimeField(uint32_t value)
+      : value_(internal::mersenne31::Reduce(value)) {}
+  constexpr PrimeField(const PrimeField& other) = default;
+  constexpr PrimeField& operator=(const PrimeField& other) = default;
+  constexpr PrimeField(PrimeField&& other) = default;
+  constexpr PrimeField& operator=(PrimeField&& other) = default;
+
+  constexpr static PrimeField Zero() { return PrimeField(); }
+
+  constexpr static PrimeField One() { return PrimeField(1); }
+
+  static PrimeField Random() {
+    return FromBigInt(BigInt<N>::Random(Config::kModulus));
+  }
+
+  static uint32_t RandomForTesting() { return Random().value_; }
+
+  constexpr static PrimeField FromDecString(std::string_view str) {
+    return FromBigInt(BigInt<N>::FromDecString(str));
+  }
+  constexpr static PrimeField FromHexString(std::string_view str) {
+    return FromBigInt(BigInt<N>::FromHexString(str));
+  }
+
+  constexpr static PrimeField FromBigInt(const BigInt<N>& big_int) {
+    DCHECK_LT(big_int, Config::kModulus);
+    return PrimeField(static_cast<uint32_t>(big_int[0]));
+  }
+
+  // NOTE: |mont| is in the montgomery form with R = 2⁶⁴ to be compatible with
+  // the generated config, e.g, |Config::kTwoAdicRootOfUnity|. Since
+  // 2⁶⁴ ≡ 4 (mod p), this multiplies |mont| by 4⁻¹ = 2²⁹.
+  constexpr static PrimeField FromMontgomery(const MontgomeryTy& mont) {
+    return PrimeField(internal::mersenne31::Mul(
+        static_cast<uint32_t>(mont[0]), uint32_t{1} << 29));
+  }
+
+  static PrimeField FromMpzClass(const mpz_class& value) {
+    BigInt<N> big_int;
+    gmp::CopyLimbs(value, big_int.limbs);
+    return FromBigInt(big_int);
+  }
+
+  static void Init() {
+    // Do nothing.
+  }
+
+  const value_type& value() const { return value_; }
+  size_t GetLimbSize() const { return N; }
+
+  constexpr bool IsZero() const { return value_ == 0; }
+
+  constexpr bool IsOne() const { return value_ == 1; }
+
+  std::string ToString() const { return ToBigInt().ToString(); }
+  std::string ToHexString(bool pad_zero = false) const {
+    return ToBigInt().ToHexString(pad_zero);
+  }
+
+  mpz_class ToMpzClass() const {
+    mpz_class ret;
+    BigInt<N> big_int = ToBigInt();
+    gmp::WriteLimbs(big_int.limbs, N, &ret);
+    return ret;
+  }
+
+  constexpr BigInt<N> ToBigInt() const { return BigInt<N>(value_); }
+
+  // Returns |value_| * 2⁶⁴ mod p = |value_| * 4 mod p, which is compatible
+  // with the montgomery form of the generic |PrimeField|.
+  constexpr BigInt<N> ToMontgomery() const {
+    return BigInt<N>(internal::mersenne31::Mul(value_, 4));
+  }
+
+  explicit operator uint32_t() const { return value_; }
+
+  constexpr bool operator==(const PrimeField& other) const {
+    return value_ == other.value_;
+  }
+
+  constexpr bool operator!=(const PrimeField& other) const {
+    return value_ != other.value_;
+  }
+
+  constexpr bool operator<(const PrimeField& other) const {
+    return value_ < other.value_;
+  }
+
+  constexpr bool operator>(const PrimeField& other) const {
+    return value_ > other.value_;
+  }
+
+  constexpr bool operator<=(const PrimeField& other) const {
+    return value_ <= other.value_;
+  }
+
+  constexpr bool operator>=(const PrimeField& other) const {
+    return value_ >= other.value_;
+  }
+
+  // This is needed by MSM.
+  // See tachyon/math/elliptic_curves/msm/variable_base_msm.h
+  BigInt<N> DivBy2Exp(uint32_t exp) const {
+    BigInt<N> ret = ToBigInt();
+    return ret.DivBy2ExpInPlace(exp);
+  }
+
+  // AdditiveSemigroup methods
+  constexpr PrimeField& AddInPlace(const PrimeField& other) {
+    value_ = internal::mont31::Add(value_, other.value_, kModulus);
+    return *this;
+  }
+
+  constexpr PrimeField& DoubleInPlace() {
+    value_ = internal::mont31::Add(value_, value_, kModulus);
+    return *this;
+  }
+
+  // AdditiveGroup methods
+  constexpr PrimeField& SubInPlace(const PrimeField& other) {
+    value_ = internal::mont31::Sub(value_, other.value_, kModulus);
+    return *this;
+  }
+
+  constexpr PrimeField& NegInPlace() {
+    value_ = internal::mont31::Sub(0, value_, kModulus);
+    return *this;
+  }
+
+  // MultiplicativeSemigroup methods
+  constexpr PrimeField& MulInPlace(const PrimeField& other) {
+    value_ = internal::mersenne31::Mul(value_, other.value_);
+    return *this;
+  }
+
+  constexpr PrimeField& SquareInPlace() {
+    value_ = internal::mersenne31::Mul(value_, value_);
+    return *this;
+  }
+
+  // MultiplicativeGroup methods
+  PrimeField& DivInPlace(const PrimeField& other) {
+    return MulInPlace(other.Inverse());
+  }
+
+  PrimeField& InverseInPlace() {
+    // See https://github.com/kroma-network/tachyon/issues/76
+    CHECK(!IsZero());
+    // a⁻¹ = aᵖ⁻² by Fermat's little theorem.
+    *this = this->Pow(BigInt<N>(kModulus - 2));
+    return *this;
+  }
+
+ private:
+  // |value_| is the element in the canonical form.
+  uint32_t value_ = 0;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MERSENNE31_H_
@@ -0,0 +1,256 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MONT31_H_
+#define TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MONT31_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/prime_field_base.h"
+
+namespace tachyon::math {
+namespace internal::mont31 {
+
+// NOTE: The functions below are written without branches, since the
+// branches depend on the values and are hard to predict.
+
+// Returns |a| + |b| mod |p| for |a| and |b| in [0, |p|).
+constexpr uint32_t Add(uint32_t a, uint32_t b, uint32_t p) {
+  // This never overflows since |p| < 2³¹.
+  uint32_t sum = a + b;
+  // |sum| - |p| wraps around to a value greater than |sum| if and only if
+  // |sum| < |p|.
+  uint32_t t = sum - p;
+  return t < sum ? t : sum;
+}
+
+// Returns |a| - |b| mod |p| for |a| and |b| in [0, |p|).
+constexpr uint32_t Sub(uint32_t a, uint32_t b, uint32_t p) {
+  uint32_t diff = a - b;
+  uint32_t t = diff + p;
+  return t < diff ? t : diff;
+}
+
+// Returns |x| * 2⁻³² mod |p| for |x| in [0, |p| * 2³²), where |mu| is |p|⁻¹
+// mod 2³². See https://en.wikipedia.org/wiki/Montgomery_modular_multiplication
+constexpr uint32_t Reduce(uint64_t x, uint32_t p, uint32_t mu) {
+  uint32_t q = static_cast<uint32_t>(x) * mu;
+  uint64_t qp = uint64_t{q} * p;
+  // The lower 32 bits of |x| and |qp| are the same, so
+  // (|x| - |qp|) / 2³² = |x_hi| - |qp_hi|.
+  uint32_t x_hi = static_cast<uint32_t>(x >> 32);
+  uint32_t qp_hi = static_cast<uint32_t>(qp >> 32);
+  uint32_t r = x_hi - qp_hi;
+  return r + (p & -uint32_t{x_hi < qp_hi});
+}
+
+// Returns |a| * |b| * 2⁻³² mod |p|.
+constexpr uint32_t Mul(uint32_t a, uint32_t b, uint32_t p, uint32_t mu) {
+  return Reduce(uint64_t{a} * b, p, mu);
+}
+
+}  // namespace internal::mont31
+
+// A prime field for p < 2³¹, such as BabyBear and KoalaBear. Unlike the
+// generic |PrimeField|, an element is kept in a single 32-bit word in the
+// montgomery form with R = 2³², so that the packed types can process twice
+// as many elements as the 64-bit fields per instruction.
+// See packed_prime_field31_avx2.h and packed_prime_field31_avx512.h.
+template <typename _Config>
+class PrimeField<_Config, std::enable_if_t<_Config::kIsMont31>> final
+    : public PrimeFieldBase<PrimeField<_Config>> {
+ public:
+  constexpr static size_t kModulusBits = _Config::kModulusBits;
+  constexpr static size_t kLimbNums = 1;
+  constexpr static size_t N = kLimbNums;
+
+  using Config = _Config;
+  using BigIntTy = BigInt<N>;
+  using MontgomeryTy = BigInt<N>;
+  using value_type = uint32_t;
+
+  static_assert(kModulusBits <= 31);
+
+  constexpr static uint32_t kModulus =
+      static_cast<uint32_t>(Config::kModulus[0]);
+  // |kInverse32| is -p⁻¹ mod 2³².
+  constexpr static uint32_t kMu = 0 - Config::kInverse32;
+  // 2³² mod p, which is 1 in the montgomery form.
+  constexpr static uint32_t kR = uint32_t{(uint64_t{1} << 32) % kModulus};
+  // 2⁶⁴ mod p
+  constexpr static uint32_t kR2 =
+      uint32_t{uint64_t{kR} * uint64_t{kR} % kModulus};
+
+  constexpr PrimeField() = default;
+  constexpr explicit PrimeField(uint32_t value)
+      : value_(internal::mont31::Mul(value % kModulus, kR2, kModulus, kMu)) {}
+  constexpr PrimeField(const PrimeField& other) = default;
+  constexpr PrimeField& operator=(const PrimeField& other) = default;
+  constexpr PrimeField(PrimeField&& other) = default;
+  constexpr PrimeField& operator=(PrimeField&& other) = default;
+
+  constexpr static PrimeField Zero() { return PrimeField(); }
+
+  constexpr static PrimeField One() { return FromRaw(kR); }
+
+  static PrimeField Random() {
+    return FromBigInt(BigInt<N>::Random(Config::kModulus));
+  }
+
+  static uint32_t RandomForTesting() { return Random().ToCanonical(); }
+
+  constexpr static PrimeField FromDecString(std::string_view str) {
+    return FromBigInt(BigInt<N>::FromDecString(str));
+  }
+  constexpr static PrimeField FromHexString(std::string_view str) {
+    return FromBigInt(BigInt<N>::FromHexString(str));
+  }
+
+  constexpr static PrimeField FromBigInt(const BigInt<N>& big_int) {
+    DCHECK_LT(big_int, Config::kModulus);
+    return PrimeField(static_cast<uint32_t>(big_int[0]));
+  }
+
+  // NOTE: |mont| is in the montgomery form with R = 2⁶⁴ to be compatible with
+  // the generated config, e.g, |Config::kTwoAdicRootOfUnity|.
+  constexpr static PrimeField FromMontgomery(const MontgomeryTy& mont) {
+    return FromRaw(internal::mont31::Reduce(mont[0], kModulus, kMu));
+  }
+
+  static PrimeField FromMpzClass(const mpz_class& value) {
+    BigInt<N> big_int;
+    gmp::CopyLimbs(value, big_int.limbs);
+    return FromBigInt(big_int);
+  }
+
+  static void Init() {
+    // Do nothing.
+  }
+
+  const value_type& value() const { return value_; }
+  size_t GetLimbSize() const { return N; }
+
+  constexpr bool IsZero() const { return value_ == 0; }
+
+  constexpr bool IsOne() const { return value_ == kR; }
+
+  std::string ToString() const { return ToBigInt().ToString(); }
+  std::string ToHexString(bool pad_zero = false) const {
+    return ToBigInt().ToHexString(pad_zero);
+  }
+
+  mpz_class ToMpzClass() const {
+    mpz_class ret;
+    BigInt<N> big_int = ToBigInt();
+    gmp::WriteLimbs(big_int.limbs, N, &ret);
+    return ret;
+  }
+
+  constexpr BigInt<N> ToBigInt() const { return BigInt<N>(ToCanonical()); }
+
+  // Returns |value_| in the montgomery form with R = 2⁶⁴, which is compatible
+  // with the montgomery form of the generic |PrimeField|.
+  constexpr BigInt<N> ToMontgomery() const {
+    return BigInt<N>(internal::mont31::Mul(value_, kR2, kModulus, kMu));
+  }
+
+  explicit operator uint32_t() const { return ToCanonical(); }
+
+  constexpr bool operator==(const PrimeField& other) const {
+    return value_ == other.value_;
+  }
+
+  constexpr bool operator!=(const PrimeField& other) const {
+    return value_ != other.value_;
+  }
+
+  constexpr bool operator<(const PrimeField& other) const {
+    return ToCanonical() < other.ToCanonical();
+  }
+
+  constexpr bool operator>(const PrimeField& other) const {
+    return ToCanonical() > other.ToCanonical();
+  }
+
+  constexpr bool operator<=(const PrimeField& other) const {
+    return ToCanonical() <= other.ToCanonical();
+  }
+
+  constexpr bool operator>=(const PrimeField& other) const {
+    return ToCanonical() >= other.ToCanonical();
+  }
+
+  // This is needed by MSM.
+  // See tachyon/math/elliptic_curves/msm/variable_base_msm.h
+  BigInt<N> DivBy2Exp(uint32_t exp) const {
+    BigInt<N> ret = ToBigInt();
+    return ret.DivBy2ExpInPlace(exp);
+  }
+
+  // AdditiveSemigroup methods
+  constexpr PrimeField& AddInPlace(const PrimeField& other) {
+    value_ = internal::mont31::Add(value_, other.value_, kModulus);
+    return *this;
+  }
+
+  constexpr PrimeField& DoubleInPlace() {
+    value_ = internal::mont31::Add(value_, value_, kModulus);
+    return *this;
+  }
+
+  // AdditiveGroup methods
+  constexpr PrimeField& SubInPlace(const PrimeField& other) {
+    value_ = internal::mont31::Sub(value_, other.value_, kModulus);
+    return *this;
+  }
+
+  constexpr PrimeField& NegInPlace() {
+    value_ = internal::mont31::Sub(0, value_, kModulus);
+    return *this;
+  }
+
+  // MultiplicativeSemigroup methods
+  constexpr PrimeField& MulInPlace(const PrimeField& other) {
+    value_ = internal::mont31::Mul(value_, other.value_, kModulus, kMu);
+    return *this;
+  }
+
+  constexpr PrimeField& SquareInPlace() {
+    value_ = internal::mont31::Mul(value_, value_, kModulus, kMu);
+    return *this;
+  }
+
+  // MultiplicativeGroup methods
+  PrimeField& DivInPlace(const PrimeField& other) {
+    return MulInPlace(other.Inverse());
+  }
+
+  PrimeField& InverseInPlace() {
+    // See https://github.com/kroma-network/tachyon/issues/76
+    CHECK(!IsZero());
+    // a⁻¹ = aᵖ⁻² by Fermat's little theorem.
+    *this = this->Pow(BigInt<N>(kModulus - 2));
+    return *this;
+  }
+
+ private:
+  constexpr static PrimeField FromRaw(uint32_t value) {
+    PrimeField ret;
+    ret.value_ = value;
+    return ret;
+  }
+
+  constexpr uint32_t ToCanonical() const {
+    return internal::mont31::Reduce(value_, kModulus, kMu);
+  }
+
+  // |value_| is the element multiplied by 2³² mod p.
+  uint32_t value_ = 0;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MONT31_H_
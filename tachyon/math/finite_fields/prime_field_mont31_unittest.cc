@@ -0,0 +1,169 @@
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear_2.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear_4.h"
+#include "tachyon/math/finite_fields/koala_bear/koala_bear.h"
+#include "tachyon/math/finite_fields/koala_bear/koala_bear_2.h"
+#include "tachyon/math/finite_fields/koala_bear/koala_bear_4.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PrimeField>
+class PrimeFieldMont31Test : public testing::Test {};
+
+}  // namespace
+
+using PrimeFieldMont31Types = testing::Types<BabyBear, KoalaBear>;
+TYPED_TEST_SUITE(PrimeFieldMont31Test, PrimeFieldMont31Types);
+
+TYPED_TEST(PrimeFieldMont31Test, FromString) {
+  using F = TypeParam;
+
+  EXPECT_EQ(F::FromDecString("3"), F(3));
+  EXPECT_EQ(F::FromHexString("0x3"), F(3));
+}
+
+TYPED_TEST(PrimeFieldMont31Test, ToString) {
+  using F = TypeParam;
+
+  F f(3);
+
+  EXPECT_EQ(f.ToString(), "3");
+  EXPECT_EQ(f.ToHexString(), "0x3");
+}
+
+TYPED_TEST(PrimeFieldMont31Test, Zero) {
+  using F = TypeParam;
+
+  EXPECT_TRUE(F::Zero().IsZero());
+  EXPECT_FALSE(F::One().IsZero());
+}
+
+TYPED_TEST(PrimeFieldMont31Test, One) {
+  using F = TypeParam;
+
+  EXPECT_TRUE(F::One().IsOne());
+  EXPECT_FALSE(F::Zero().IsOne());
+  EXPECT_EQ(F::Config::kOne, F(1).ToMontgomery());
+}
+
+TYPED_TEST(PrimeFieldMont31Test, BigIntConversion) {
+  using F = TypeParam;
+
+  F r = F::Random();
+  EXPECT_EQ(F::FromBigInt(r.ToBigInt()), r);
+}
+
+TYPED_TEST(PrimeFieldMont31Test, MontgomeryConversion) {
+  using F = TypeParam;
+
+  F r = F::Random();
+  EXPECT_EQ(F::FromMontgomery(r.ToMontgomery()), r);
+}
+
+TYPED_TEST(PrimeFieldMont31Test, MpzClassConversion) {
+  using F = TypeParam;
+
+  F r = F::Random();
+  EXPECT_EQ(F::FromMpzClass(r.ToMpzClass()), r);
+}
+
+TYPED_TEST(PrimeFieldMont31Test, ComparisonOperator) {
+  using F = TypeParam;
+
+  F f(3);
+  F f2(4);
+  EXPECT_TRUE(f < f2);
+  EXPECT_TRUE(f <= f2);
+  EXPECT_FALSE(f > f2);
+  EXPECT_FALSE(f >= f2);
+}
+
+TYPED_TEST(PrimeFieldMont31Test, Operators) {
+  using F = TypeParam;
+
+  uint64_t M = F::Config::kModulus[0];
+
+  uint64_t a = F::RandomForTesting();
+  uint64_t b = F::RandomForTesting();
+  SCOPED_TRACE(absl::Substitute("a: $0, b: $1", a, b));
+
+  F fa(a);
+  F fb(b);
+
+  EXPECT_EQ(static_cast<uint32_t>(fa + fb), (a + b) % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa - fb), (a + M - b) % M);
+  EXPECT_EQ(static_cast<uint32_t>(-fa), (M - a) % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa.Double()), (a + a) % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa * fb), a * b % M);
+  EXPECT_EQ(static_cast<uint32_t>(fa.Square()), a * a % M);
+  if (!fb.IsZero()) {
+    EXPECT_EQ(fa * fb / fb, fa);
+    EXPECT_EQ(fb * fb.Inverse(), F::One());
+  }
+}
+
+TYPED_TEST(PrimeFieldMont31Test, Reduction) {
+  using F = TypeParam;
+
+  F minus_one = -F::One();
+  EXPECT_EQ(static_cast<uint32_t>(minus_one), F::Config::kModulus[0] - 1);
+  EXPECT_EQ(minus_one * minus_one, F::One());
+  EXPECT_EQ(minus_one + F::One(), F::Zero());
+  EXPECT_EQ(F::Zero() - F::One(), minus_one);
+  EXPECT_EQ(F(F::Config::kModulus[0]), F::Zero());
+  EXPECT_EQ(F(UINT32_MAX), F(UINT32_MAX % F::Config::kModulus[0]));
+}
+
+TYPED_TEST(PrimeFieldMont31Test, RootOfUnity) {
+  using F = TypeParam;
+
+  uint32_t two_adicity = F::Config::kTwoAdicity;
+  F root;
+  ASSERT_TRUE(F::GetRootOfUnity(uint64_t{1} << two_adicity, &root));
+  EXPECT_EQ(root.Pow(uint64_t{1} << (two_adicity - 1)), -F::One());
+  EXPECT_EQ(root.Pow(uint64_t{1} << two_adicity), F::One());
+  EXPECT_FALSE(F::GetRootOfUnity(uint64_t{1} << (two_adicity + 1), &root));
+}
+
+namespace {
+
+template <typename ExtField>
+class PrimeFieldMont31ExtensionFieldTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { ExtField::Init(); }
+};
+
+}  // namespace
+
+using ExtFieldTypes =
+    testing::Types<BabyBear2, BabyBear4, KoalaBear2, KoalaBear4>;
+TYPED_TEST_SUITE(PrimeFieldMont31ExtensionFieldTest, ExtFieldTypes);
+
+TYPED_TEST(PrimeFieldMont31ExtensionFieldTest, MultiplicativeGroupOperators) {
+  using ExtField = TypeParam;
+
+  ExtField a = ExtField::Random();
+  ExtField b = ExtField::Random();
+  ExtField c = ExtField::Random();
+  EXPECT_EQ(a * a.Inverse(), ExtField::One());
+  EXPECT_EQ(a.Square(), a * a);
+  EXPECT_EQ((a + b) * c, a * c + b * c);
+  EXPECT_EQ(a * b / b, a);
+}
+
+TYPED_TEST(PrimeFieldMont31ExtensionFieldTest, FrobeniusMap) {
+  using ExtField = TypeParam;
+  using BasePrimeField = typename ExtField::BasePrimeField;
+
+  ExtField a = ExtField::Random();
+  ExtField a_pow = a.Pow(BasePrimeField::Config::kModulus);
+  a.FrobeniusMapInPlace(1);
+  EXPECT_EQ(a_pow, a);
+}
+
+}  // namespace tachyon::math
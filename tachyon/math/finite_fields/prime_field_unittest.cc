@@ -156,6 +156,25 @@ TEST_F(PrimeFieldTest, SumOfProductsSerial) {
   EXPECT_EQ(GF7::SumOfProductsSerial(a, b), GF7(2));
 }
 
+TEST_F(PrimeFieldTest, UnreducedOperators) {
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      GF7 a(i);
+      GF7 b(j);
+      GF7::UnreducedTy ab = a.MulUnreduced(b);
+      EXPECT_EQ(GF7::FromUnreduced(ab), a * b);
+
+      GF7::UnreducedTy sum = ab;
+      GF7::AddUnreducedInPlace(&sum, b.MulUnreduced(b));
+      EXPECT_EQ(GF7::FromUnreduced(sum), a * b + b * b);
+
+      GF7::UnreducedTy diff = ab;
+      GF7::SubUnreducedInPlace(&diff, a.MulUnreduced(a));
+      EXPECT_EQ(GF7::FromUnreduced(diff), a * b - a * a);
+    }
+  }
+}
+
 TEST_F(PrimeFieldTest, Random) {
   bool success = false;
   GF7 r = GF7::Random();
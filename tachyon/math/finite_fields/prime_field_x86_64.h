@@ -0,0 +1,1030 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_X86_64_H_
+#define TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_X86_64_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/base/cpu_features.h"
+
+namespace tachyon::math::internal::x86_64 {
+
+// True if the CPU supports MULX (BMI2), ADCX and ADOX (ADX). This is
+// evaluated once at startup. Until then, it reads false and the portable
+// implementation is used.
+inline const bool kHasBmi2AndAdx =
+    base::HasCpuFeature(base::CpuFeature::kBmi2) &&
+    base::HasCpuFeature(base::CpuFeature::kAdx);
+
+// Limb sizes for which |MontMul()|, |MulWide()| and |MontReduce()| are
+// implemented. 4 limbs cover the 254 and 255-bit fields (e.g., bn254,
+// bls12-381 Fr) and 6 limbs cover the 381-bit fields (e.g., bls12-381 Fq).
+template <size_t N>
+constexpr bool kHasMontMul = N == 4 || N == 6;
+
+// Computes |a| = |a| * |b| * R⁻¹ mod |p| with the CIOS Montgomery
+// multiplication, where R = 2^(64 * N) and |inv| = -|p|⁻¹ mod 2⁶⁴. Every
+// outer iteration runs two carry chains at once: ADCX propagates the carry of
+// the low halves through CF and ADOX propagates the carry of the high halves
+// through OF, while MULX leaves the flags untouched. The two chains, the
+// register rotation and the final subtraction are fully unrolled.
+//
+// NOTE: |p| must have a spare bit, i.e., 2 * |p| < R, so that the
+// intermediate result fits in N + 1 limbs and the result is reduced by a
+// single subtraction. |a| and |b| may alias.
+template <size_t N>
+void MontMul(uint64_t a[N], const uint64_t b[N], const uint64_t p[N],
+             uint64_t inv);
+
+// Computes the 2N-limb product |r| = |a| * |b| without any reduction. The
+// rows are accumulated with the same two carry chains as |MontMul()|. |r|
+// must not alias |a| or |b|.
+template <size_t N>
+void MulWide(uint64_t r[2 * N], const uint64_t a[N], const uint64_t b[N]);
+
+// Computes |out| = |t| * R⁻¹ mod |p| for |t| in [0, |p| * R), where R =
+// 2^(64 * N) and |inv| = -|p|⁻¹ mod 2⁶⁴. The lower N limbs of |t| are reduced
+// with the same carry chains as |MontMul()| and the upper N limbs are added
+// afterwards, i.e., (t_lo + m * p) / R + t_hi.
+//
+// NOTE: |p| must have a spare bit just like |MontMul()|.
+template <size_t N>
+void MontReduce(uint64_t out[N], const uint64_t t[2 * N], const uint64_t p[N],
+                uint64_t inv);
+
+template <>
+inline void MontMul<4>(uint64_t a[4], const uint64_t b[4], const uint64_t p[4],
+                       uint64_t inv) {
+  // clang-format off
+  __asm__ volatile(
+      // t = a * b[0]
+      "xorl %%eax, %%eax\n\t"
+      "movq (%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%r8, %%r9\n\t"
+      "mulxq 8(%[a]), %%rbx, %%r10\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "mulxq 16(%[a]), %%rbx, %%r11\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r12\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r8, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      // t += a * b[1]
+      "xorl %%eax, %%eax\n\t"
+      "movq 8(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r8\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      "adoxq %%rax, %%r8\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r9, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      // t += a * b[2]
+      "xorl %%eax, %%eax\n\t"
+      "movq 16(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r9\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      "adoxq %%rax, %%r9\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r10, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      // t += a * b[3]
+      "xorl %%eax, %%eax\n\t"
+      "movq 24(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r10\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      "adoxq %%rax, %%r10\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r11, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      // Subtract p if t >= p.
+      "movq %%r12, (%[a])\n\t"
+      "movq %%r8, 8(%[a])\n\t"
+      "movq %%r9, 16(%[a])\n\t"
+      "movq %%r10, 24(%[a])\n\t"
+      "subq (%[p]), %%r12\n\t"
+      "sbbq 8(%[p]), %%r8\n\t"
+      "sbbq 16(%[p]), %%r9\n\t"
+      "sbbq 24(%[p]), %%r10\n\t"
+      "cmovcq (%[a]), %%r12\n\t"
+      "cmovcq 8(%[a]), %%r8\n\t"
+      "cmovcq 16(%[a]), %%r9\n\t"
+      "cmovcq 24(%[a]), %%r10\n\t"
+      "movq %%r12, (%[a])\n\t"
+      "movq %%r8, 8(%[a])\n\t"
+      "movq %%r9, 16(%[a])\n\t"
+      "movq %%r10, 24(%[a])\n\t"
+      :
+      : [a] "r"(a), [b] "r"(b), [p] "r"(p), [inv] "m"(inv)
+      : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "cc", "memory");
+  // clang-format on
+}
+
+template <>
+inline void MontMul<6>(uint64_t a[6], const uint64_t b[6], const uint64_t p[6],
+                       uint64_t inv) {
+  // clang-format off
+  __asm__ volatile(
+      // t = a * b[0]
+      "xorl %%eax, %%eax\n\t"
+      "movq (%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%r8, %%r9\n\t"
+      "mulxq 8(%[a]), %%rbx, %%r10\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "mulxq 16(%[a]), %%rbx, %%r11\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r12\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "mulxq 32(%[a]), %%rbx, %%r13\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r14\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adcxq %%rax, %%r14\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r8, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 40(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r14\n\t"
+      "adcxq %%rax, %%r14\n\t"
+      // t += a * b[1]
+      "xorl %%eax, %%eax\n\t"
+      "movq 8(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r8\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      "adoxq %%rax, %%r8\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r9, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r14\n\t"
+      "mulxq 40(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r14\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      // t += a * b[2]
+      "xorl %%eax, %%eax\n\t"
+      "movq 16(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r9\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      "adoxq %%rax, %%r9\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r10, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r14\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r14\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 40(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      // t += a * b[3]
+      "xorl %%eax, %%eax\n\t"
+      "movq 24(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r10\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      "adoxq %%rax, %%r10\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r11, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r14\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r14\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 40(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      // t += a * b[4]
+      "xorl %%eax, %%eax\n\t"
+      "movq 32(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r11\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rax, %%r11\n\t"
+      "adoxq %%rax, %%r11\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r12, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r14\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r14\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 40(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "adcxq %%rax, %%r11\n\t"
+      // t += a * b[5]
+      "xorl %%eax, %%eax\n\t"
+      "movq 40(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r12\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      "adoxq %%rax, %%r12\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r13, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r14\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r14\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 40(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      // Subtract p if t >= p.
+      "movq %%r14, (%[a])\n\t"
+      "movq %%r8, 8(%[a])\n\t"
+      "movq %%r9, 16(%[a])\n\t"
+      "movq %%r10, 24(%[a])\n\t"
+      "movq %%r11, 32(%[a])\n\t"
+      "movq %%r12, 40(%[a])\n\t"
+      "subq (%[p]), %%r14\n\t"
+      "sbbq 8(%[p]), %%r8\n\t"
+      "sbbq 16(%[p]), %%r9\n\t"
+      "sbbq 24(%[p]), %%r10\n\t"
+      "sbbq 32(%[p]), %%r11\n\t"
+      "sbbq 40(%[p]), %%r12\n\t"
+      "cmovcq (%[a]), %%r14\n\t"
+      "cmovcq 8(%[a]), %%r8\n\t"
+      "cmovcq 16(%[a]), %%r9\n\t"
+      "cmovcq 24(%[a]), %%r10\n\t"
+      "cmovcq 32(%[a]), %%r11\n\t"
+      "cmovcq 40(%[a]), %%r12\n\t"
+      "movq %%r14, (%[a])\n\t"
+      "movq %%r8, 8(%[a])\n\t"
+      "movq %%r9, 16(%[a])\n\t"
+      "movq %%r10, 24(%[a])\n\t"
+      "movq %%r11, 32(%[a])\n\t"
+      "movq %%r12, 40(%[a])\n\t"
+      :
+      : [a] "r"(a), [b] "r"(b), [p] "r"(p), [inv] "m"(inv)
+      : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "cc", "memory");
+  // clang-format on
+}
+
+template <>
+inline void MulWide<4>(uint64_t r[8], const uint64_t a[4],
+                       const uint64_t b[4]) {
+  // clang-format off
+  __asm__ volatile(
+      // t = a * b[0]
+      "xorl %%eax, %%eax\n\t"
+      "movq (%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%r8, %%r9\n\t"
+      "mulxq 8(%[a]), %%rbx, %%r10\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "mulxq 16(%[a]), %%rbx, %%r11\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r12\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      "movq %%r8, (%[r])\n\t"
+      // t += a * b[1]
+      "xorl %%eax, %%eax\n\t"
+      "movq 8(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r8\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      "adoxq %%rax, %%r8\n\t"
+      "movq %%r9, 8(%[r])\n\t"
+      // t += a * b[2]
+      "xorl %%eax, %%eax\n\t"
+      "movq 16(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r9\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      "adoxq %%rax, %%r9\n\t"
+      "movq %%r10, 16(%[r])\n\t"
+      // t += a * b[3]
+      "xorl %%eax, %%eax\n\t"
+      "movq 24(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r10\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      "adoxq %%rax, %%r10\n\t"
+      "movq %%r11, 24(%[r])\n\t"
+      "movq %%r12, 32(%[r])\n\t"
+      "movq %%r8, 40(%[r])\n\t"
+      "movq %%r9, 48(%[r])\n\t"
+      "movq %%r10, 56(%[r])\n\t"
+      :
+      : [r] "r"(r), [a] "r"(a), [b] "r"(b)
+      : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "cc", "memory");
+  // clang-format on
+}
+
+template <>
+inline void MulWide<6>(uint64_t r[12], const uint64_t a[6],
+                       const uint64_t b[6]) {
+  // clang-format off
+  __asm__ volatile(
+      // t = a * b[0]
+      "xorl %%eax, %%eax\n\t"
+      "movq (%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%r8, %%r9\n\t"
+      "mulxq 8(%[a]), %%rbx, %%r10\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "mulxq 16(%[a]), %%rbx, %%r11\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "mulxq 24(%[a]), %%rbx, %%r12\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "mulxq 32(%[a]), %%rbx, %%r13\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r14\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adcxq %%rax, %%r14\n\t"
+      "movq %%r8, (%[r])\n\t"
+      // t += a * b[1]
+      "xorl %%eax, %%eax\n\t"
+      "movq 8(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r8\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      "adoxq %%rax, %%r8\n\t"
+      "movq %%r9, 8(%[r])\n\t"
+      // t += a * b[2]
+      "xorl %%eax, %%eax\n\t"
+      "movq 16(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r9\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      "adoxq %%rax, %%r9\n\t"
+      "movq %%r10, 16(%[r])\n\t"
+      // t += a * b[3]
+      "xorl %%eax, %%eax\n\t"
+      "movq 24(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r10\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      "adoxq %%rax, %%r10\n\t"
+      "movq %%r11, 24(%[r])\n\t"
+      // t += a * b[4]
+      "xorl %%eax, %%eax\n\t"
+      "movq 32(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r12\n\t"
+      "adcxq %%rcx, %%r13\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r11\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rax, %%r11\n\t"
+      "adoxq %%rax, %%r11\n\t"
+      "movq %%r12, 32(%[r])\n\t"
+      // t += a * b[5]
+      "xorl %%eax, %%eax\n\t"
+      "movq 40(%[b]), %%rdx\n\t"
+      "mulxq (%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r13\n\t"
+      "adcxq %%rcx, %%r14\n\t"
+      "mulxq 8(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r14\n\t"
+      "adcxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r8\n\t"
+      "adcxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r9\n\t"
+      "adcxq %%rcx, %%r10\n\t"
+      "mulxq 32(%[a]), %%rbx, %%rcx\n\t"
+      "adoxq %%rbx, %%r10\n\t"
+      "adcxq %%rcx, %%r11\n\t"
+      "mulxq 40(%[a]), %%rbx, %%r12\n\t"
+      "adoxq %%rbx, %%r11\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      "adoxq %%rax, %%r12\n\t"
+      "movq %%r13, 40(%[r])\n\t"
+      "movq %%r14, 48(%[r])\n\t"
+      "movq %%r8, 56(%[r])\n\t"
+      "movq %%r9, 64(%[r])\n\t"
+      "movq %%r10, 72(%[r])\n\t"
+      "movq %%r11, 80(%[r])\n\t"
+      "movq %%r12, 88(%[r])\n\t"
+      :
+      : [r] "r"(r), [a] "r"(a), [b] "r"(b)
+      : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "cc", "memory");
+  // clang-format on
+}
+
+template <>
+inline void MontReduce<4>(uint64_t out[4], const uint64_t t[8],
+                          const uint64_t p[4], uint64_t inv) {
+  // clang-format off
+  __asm__ volatile(
+      // t = t[0..N)
+      "movq (%[t]), %%r8\n\t"
+      "movq 8(%[t]), %%r9\n\t"
+      "movq 16(%[t]), %%r10\n\t"
+      "movq 24(%[t]), %%r11\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r8, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 24(%[p]), %%rbx, %%r8\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      "adoxq %%rax, %%r8\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r9, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[p]), %%rbx, %%r9\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      "adoxq %%rax, %%r9\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r10, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[p]), %%rbx, %%r10\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      "adoxq %%rax, %%r10\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r11, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 24(%[p]), %%rbx, %%r11\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adcxq %%rax, %%r11\n\t"
+      "adoxq %%rax, %%r11\n\t"
+      // t += t[N..2N)
+      "addq 32(%[t]), %%r8\n\t"
+      "adcq 40(%[t]), %%r9\n\t"
+      "adcq 48(%[t]), %%r10\n\t"
+      "adcq 56(%[t]), %%r11\n\t"
+      // Subtract p if t >= p.
+      "movq %%r8, (%[out])\n\t"
+      "movq %%r9, 8(%[out])\n\t"
+      "movq %%r10, 16(%[out])\n\t"
+      "movq %%r11, 24(%[out])\n\t"
+      "subq (%[p]), %%r8\n\t"
+      "sbbq 8(%[p]), %%r9\n\t"
+      "sbbq 16(%[p]), %%r10\n\t"
+      "sbbq 24(%[p]), %%r11\n\t"
+      "cmovcq (%[out]), %%r8\n\t"
+      "cmovcq 8(%[out]), %%r9\n\t"
+      "cmovcq 16(%[out]), %%r10\n\t"
+      "cmovcq 24(%[out]), %%r11\n\t"
+      "movq %%r8, (%[out])\n\t"
+      "movq %%r9, 8(%[out])\n\t"
+      "movq %%r10, 16(%[out])\n\t"
+      "movq %%r11, 24(%[out])\n\t"
+      :
+      : [out] "r"(out), [t] "r"(t), [p] "r"(p), [inv] "m"(inv)
+      : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "cc", "memory");
+  // clang-format on
+}
+
+template <>
+inline void MontReduce<6>(uint64_t out[6], const uint64_t t[12],
+                          const uint64_t p[6], uint64_t inv) {
+  // clang-format off
+  __asm__ volatile(
+      // t = t[0..N)
+      "movq (%[t]), %%r8\n\t"
+      "movq 8(%[t]), %%r9\n\t"
+      "movq 16(%[t]), %%r10\n\t"
+      "movq 24(%[t]), %%r11\n\t"
+      "movq 32(%[t]), %%r12\n\t"
+      "movq 40(%[t]), %%r13\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r8, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 40(%[p]), %%rbx, %%r8\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adcxq %%rax, %%r8\n\t"
+      "adoxq %%rax, %%r8\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r9, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 40(%[p]), %%rbx, %%r9\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adcxq %%rax, %%r9\n\t"
+      "adoxq %%rax, %%r9\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r10, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 40(%[p]), %%rbx, %%r10\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adcxq %%rax, %%r10\n\t"
+      "adoxq %%rax, %%r10\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r11, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 40(%[p]), %%rbx, %%r11\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adcxq %%rax, %%r11\n\t"
+      "adoxq %%rax, %%r11\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r12, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adoxq %%rcx, %%r13\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 40(%[p]), %%rbx, %%r12\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adcxq %%rax, %%r12\n\t"
+      "adoxq %%rax, %%r12\n\t"
+      // t = (t + m * p) / 2⁶⁴, where m = t[0] * inv
+      "movq %%r13, %%rdx\n\t"
+      "imulq %[inv], %%rdx\n\t"
+      "xorl %%eax, %%eax\n\t"
+      "mulxq (%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r13\n\t"
+      "adoxq %%rcx, %%r8\n\t"
+      "mulxq 8(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r8\n\t"
+      "adoxq %%rcx, %%r9\n\t"
+      "mulxq 16(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r9\n\t"
+      "adoxq %%rcx, %%r10\n\t"
+      "mulxq 24(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r10\n\t"
+      "adoxq %%rcx, %%r11\n\t"
+      "mulxq 32(%[p]), %%rbx, %%rcx\n\t"
+      "adcxq %%rbx, %%r11\n\t"
+      "adoxq %%rcx, %%r12\n\t"
+      "mulxq 40(%[p]), %%rbx, %%r13\n\t"
+      "adcxq %%rbx, %%r12\n\t"
+      "adcxq %%rax, %%r13\n\t"
+      "adoxq %%rax, %%r13\n\t"
+      // t += t[N..2N)
+      "addq 48(%[t]), %%r8\n\t"
+      "adcq 56(%[t]), %%r9\n\t"
+      "adcq 64(%[t]), %%r10\n\t"
+      "adcq 72(%[t]), %%r11\n\t"
+      "adcq 80(%[t]), %%r12\n\t"
+      "adcq 88(%[t]), %%r13\n\t"
+      // Subtract p if t >= p.
+      "movq %%r8, (%[out])\n\t"
+      "movq %%r9, 8(%[out])\n\t"
+      "movq %%r10, 16(%[out])\n\t"
+      "movq %%r11, 24(%[out])\n\t"
+      "movq %%r12, 32(%[out])\n\t"
+      "movq %%r13, 40(%[out])\n\t"
+      "subq (%[p]), %%r8\n\t"
+      "sbbq 8(%[p]), %%r9\n\t"
+      "sbbq 16(%[p]), %%r10\n\t"
+      "sbbq 24(%[p]), %%r11\n\t"
+      "sbbq 32(%[p]), %%r12\n\t"
+      "sbbq 40(%[p]), %%r13\n\t"
+      "cmovcq (%[out]), %%r8\n\t"
+      "cmovcq 8(%[out]), %%r9\n\t"
+      "cmovcq 16(%[out]), %%r10\n\t"
+      "cmovcq 24(%[out]), %%r11\n\t"
+      "cmovcq 32(%[out]), %%r12\n\t"
+      "cmovcq 40(%[out]), %%r13\n\t"
+      "movq %%r8, (%[out])\n\t"
+      "movq %%r9, 8(%[out])\n\t"
+      "movq %%r10, 16(%[out])\n\t"
+      "movq %%r11, 24(%[out])\n\t"
+      "movq %%r12, 32(%[out])\n\t"
+      "movq %%r13, 40(%[out])\n\t"
+      :
+      : [out] "r"(out), [t] "r"(t), [p] "r"(p), [inv] "m"(inv)
+      : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "cc", "memory");
+  // clang-format on
+}
+
+}  // namespace tachyon::math::internal::x86_64
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_X86_64_H_
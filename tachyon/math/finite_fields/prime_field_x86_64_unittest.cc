@@ -0,0 +1,89 @@
+#include "tachyon/math/finite_fields/prime_field_x86_64.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PrimeFieldType>
+class PrimeFieldX86_64Test : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PrimeFieldType::Init(); }
+};
+
+}  // namespace
+
+using PrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr, bls12_381::Fq>;
+TYPED_TEST_SUITE(PrimeFieldX86_64Test, PrimeFieldTypes);
+
+TYPED_TEST(PrimeFieldX86_64Test, MontMul) {
+  using F = TypeParam;
+  using BigIntTy = typename F::BigIntTy;
+  constexpr size_t N = F::N;
+
+  if (!internal::x86_64::kHasBmi2AndAdx) {
+    GTEST_SKIP() << "BMI2 and ADX are not supported";
+  }
+
+  for (size_t i = 0; i < 1000; ++i) {
+    F a = F::Random();
+    F b = F::Random();
+    // The expected value is computed by the portable schoolbook multiplication
+    // followed by the montgomery reduction.
+    BigIntTy expected;
+    BigInt<N * 2> wide = a.ToMontgomery().Mul(b.ToMontgomery());
+    BigIntTy::template MontgomeryReduce64<F::Config::kModulusHasSpareBit>(
+        wide, F::Config::kModulus, F::Config::kInverse64, &expected);
+
+    BigIntTy actual = a.ToMontgomery();
+    internal::x86_64::MontMul<N>(actual.limbs, b.ToMontgomery().limbs,
+                                 F::Config::kModulus.limbs,
+                                 F::Config::kInverse64);
+    EXPECT_EQ(actual, expected);
+
+    BigInt<N * 2> wide_square = a.ToMontgomery().Mul(a.ToMontgomery());
+    BigIntTy::template MontgomeryReduce64<F::Config::kModulusHasSpareBit>(
+        wide_square, F::Config::kModulus, F::Config::kInverse64, &expected);
+    actual = a.ToMontgomery();
+    internal::x86_64::MontMul<N>(actual.limbs, actual.limbs,
+                                 F::Config::kModulus.limbs,
+                                 F::Config::kInverse64);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TYPED_TEST(PrimeFieldX86_64Test, MulWideAndMontReduce) {
+  using F = TypeParam;
+  using BigIntTy = typename F::BigIntTy;
+  constexpr size_t N = F::N;
+
+  if (!internal::x86_64::kHasBmi2AndAdx) {
+    GTEST_SKIP() << "BMI2 and ADX are not supported";
+  }
+
+  for (size_t i = 0; i < 1000; ++i) {
+    F a = F::Random();
+    F b = F::Random();
+    BigInt<N * 2> expected_wide = a.ToMontgomery().Mul(b.ToMontgomery());
+    BigInt<N * 2> wide;
+    internal::x86_64::MulWide<N>(wide.limbs, a.ToMontgomery().limbs,
+                                 b.ToMontgomery().limbs);
+    EXPECT_EQ(wide, expected_wide);
+
+    BigIntTy expected;
+    BigIntTy::template MontgomeryReduce64<F::Config::kModulusHasSpareBit>(
+        expected_wide, F::Config::kModulus, F::Config::kInverse64, &expected);
+    BigIntTy actual;
+    internal::x86_64::MontReduce<N>(actual.limbs, wide.limbs,
+                                    F::Config::kModulus.limbs,
+                                    F::Config::kInverse64);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+}  // namespace tachyon::math
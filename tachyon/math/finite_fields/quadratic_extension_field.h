@@ -7,6 +7,7 @@
 #define TACHYON_MATH_FINITE_FIELDS_QUADRATIC_EXTENSION_FIELD_H_
 
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "absl/strings/substitute.h"
@@ -17,6 +18,17 @@
 
 namespace tachyon {
 namespace math {
+namespace internal {
+
+// True if |F| supports the lazy reduction. See |PrimeField::UnreducedTy|.
+template <typename F, typename SFINAE = void>
+constexpr bool kSupportsLazyReduction = false;
+
+template <typename F>
+constexpr bool
+    kSupportsLazyReduction<F, std::void_t<typename F::UnreducedTy>> = true;
+
+}  // namespace internal
 
 template <typename Derived>
 class QuadraticExtensionField
@@ -152,7 +164,10 @@ class QuadraticExtensionField
     //   = (c0 * other.c0 + c1 * other.c1 * q, c0 * other.c0 +  c1 * other.c0)
     // Where q is Config::kNonResidue.
     // clang-format on
-    if constexpr (ExtensionDegree() == 2) {
+    if constexpr (ExtensionDegree() == 2 &&
+                  internal::kSupportsLazyReduction<BaseField>) {
+      return LazyMulInPlace(other);
+    } else if constexpr (ExtensionDegree() == 2) {
       BaseField c0;
       {
         BaseField lefts[] = {c0_, Config::MulByNonResidue(c1_)};
@@ -288,6 +303,42 @@ class QuadraticExtensionField
   }
 
  protected:
+  // Multiplies with the unreduced products of |BaseField| and reduces once per
+  // output coefficient, i.e., 2 montgomery reductions instead of 4.
+  // See |PrimeField::UnreducedTy|.
+  constexpr Derived& LazyMulInPlace(const Derived& other) {
+    using UnreducedTy = typename BaseField::UnreducedTy;
+
+    UnreducedTy c0;
+    UnreducedTy c1;
+    if constexpr (Config::kNonResidueIsMinusOne) {
+      // Karatsuba multiplication with 3 products.
+      // v0 = c0 * other.c0
+      c0 = c0_.MulUnreduced(other.c0_);
+      // v1 = c1 * other.c1
+      UnreducedTy v1 = c1_.MulUnreduced(other.c1_);
+      // c1 = (c0 + c1) * (other.c0 + other.c1) - v0 - v1
+      //    = c0 * other.c1 + c1 * other.c0
+      c1 = (c0_ + c1_).MulUnreduced(other.c0_ + other.c1_);
+      BaseField::SubUnreducedInPlace(&c1, c0);
+      BaseField::SubUnreducedInPlace(&c1, v1);
+      // c0 = v0 - v1
+      //    = c0 * other.c0 + c1 * other.c1 * q, where q = -1
+      BaseField::SubUnreducedInPlace(&c0, v1);
+    } else {
+      // c0 = c0 * other.c0 + (c1 * q) * other.c1
+      c0 = c0_.MulUnreduced(other.c0_);
+      BaseField::AddUnreducedInPlace(
+          &c0, Config::MulByNonResidue(c1_).MulUnreduced(other.c1_));
+      // c1 = c0 * other.c1 + c1 * other.c0
+      c1 = c0_.MulUnreduced(other.c1_);
+      BaseField::AddUnreducedInPlace(&c1, c1_.MulUnreduced(other.c0_));
+    }
+    c0_ = BaseField::FromUnreduced(c0);
+    c1_ = BaseField::FromUnreduced(c1);
+    return *static_cast<Derived*>(this);
+  }
+
   // c = c0_ + c1_ * X
   BaseField c0_;
   BaseField c1_;
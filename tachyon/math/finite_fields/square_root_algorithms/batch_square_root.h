@@ -0,0 +1,141 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_BATCH_SQUARE_ROOT_H_
+#define TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_BATCH_SQUARE_ROOT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/tonelli_shanks.h"
+
+namespace tachyon::math {
+namespace internal {
+
+// An exponent split into |kWindowBits|-bit windows from the most significant
+// one. The windows are computed once and shared by all the exponentiations of
+// a batch, and each exponentiation only pays for its own table of
+// [1, a, a², ..., a^(2^|kWindowBits| - 1)].
+template <size_t N>
+class FixedWindowExponent {
+ public:
+  constexpr static size_t kWindowBits = 4;
+  constexpr static size_t kTableSize = size_t{1} << kWindowBits;
+
+  explicit FixedWindowExponent(const BigInt<N>& exponent) {
+    size_t num_windows = (N * 64 + kWindowBits - 1) / kWindowBits;
+    windows_.reserve(num_windows);
+    for (size_t i = num_windows - 1; i != SIZE_MAX; --i) {
+      uint8_t window = 0;
+      for (size_t j = kWindowBits - 1; j != SIZE_MAX; --j) {
+        size_t bit = i * kWindowBits + j;
+        window <<= 1;
+        if (bit < N * 64) {
+          window |= (exponent[bit / 64] >> (bit % 64)) & 1;
+        }
+      }
+      // Skip the leading zero windows.
+      if (windows_.empty() && window == 0) continue;
+      windows_.push_back(window);
+    }
+  }
+
+  // Returns aᵉ, where e is the exponent.
+  template <typename F>
+  F Pow(const F& a) const {
+    if (windows_.empty()) return F::One();
+
+    std::array<F, kTableSize> table;
+    table[0] = F::One();
+    table[1] = a;
+    for (size_t i = 2; i < kTableSize; ++i) {
+      table[i] = table[i - 1] * a;
+    }
+
+    F ret = table[windows_[0]];
+    for (size_t i = 1; i < windows_.size(); ++i) {
+      for (size_t j = 0; j < kWindowBits; ++j) {
+        ret.SquareInPlace();
+      }
+      if (windows_[i] != 0) {
+        ret *= table[windows_[i]];
+      }
+    }
+    return ret;
+  }
+
+ private:
+  std::vector<uint8_t> windows_;
+};
+
+// Each square root costs a full exponentiation, so it is worth parallelizing
+// even a small batch.
+constexpr size_t kParallelBatchSquareRootThreshold = 16;
+
+}  // namespace internal
+
+// Computes the square roots of |values| to |roots|, which may be the same span
+// as |values|. Returns false if any of |values| is a quadratic non-residue.
+// Each square root costs a full exponentiation, so the exponent is decomposed
+// once for the batch and the exponentiations run in parallel.
+template <typename F>
+bool ComputeBatchSquareRoot(absl::Span<const F> values, absl::Span<F> roots) {
+  using Config = typename F::Config;
+
+  if (values.size() != roots.size()) {
+    LOG(ERROR) << "Size of |values| and |roots| do not match";
+    return false;
+  }
+
+  if constexpr (Config::kModulusModFourIsThree) {
+    // See |ComputeShanksSquareRoot()|.
+    internal::FixedWindowExponent exponent(Config::kModulusPlusOneDivFour);
+    std::vector<uint8_t> results = base::ParallelizeMap(
+        roots, [&values, &exponent](absl::Span<F> chunk, size_t chunk_index,
+                                    size_t chunk_size) {
+          size_t offset = chunk_index * chunk_size;
+          bool success = true;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            const F& a = values[offset + i];
+            F sqrt = exponent.Pow(a);
+            success &= sqrt.Square() == a;
+            chunk[i] = std::move(sqrt);
+          }
+          return uint8_t{success};
+        },
+        internal::kParallelBatchSquareRootThreshold);
+    return std::all_of(results.begin(), results.end(),
+                       [](uint8_t success) { return success; });
+  } else {
+    static_assert(Config::kHasTwoAdicRootOfUnity);
+    // See |ComputeTonelliShanksSquareRoot()|.
+    internal::FixedWindowExponent exponent(Config::kTraceMinusOneDivTwo);
+    F z = F::FromMontgomery(Config::kTwoAdicRootOfUnity);
+    std::vector<uint8_t> results = base::ParallelizeMap(
+        roots, [&values, &exponent, &z](absl::Span<F> chunk, size_t chunk_index,
+                                        size_t chunk_size) {
+          size_t offset = chunk_index * chunk_size;
+          bool success = true;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            const F& a = values[offset + i];
+            success &= ComputeTonelliShanksSquareRootFromPower(
+                a, exponent.Pow(a), z, &chunk[i]);
+          }
+          return uint8_t{success};
+        },
+        internal::kParallelBatchSquareRootThreshold);
+    return std::all_of(results.begin(), results.end(),
+                       [](uint8_t success) { return success; });
+  }
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_BATCH_SQUARE_ROOT_H_
@@ -10,12 +10,13 @@
 
 namespace tachyon::math {
 
+// Same as |ComputeTonelliShanksSquareRoot()| below, but |w| is given as
+// a^((T - 1) / 2), which is the only exponentiation of the algorithm. This is
+// used when the exponentiations are done in batch. See
+// |ComputeBatchSquareRoot()|.
 template <typename F>
-constexpr bool ComputeTonelliShanksSquareRoot(
-    const F& a, const F& quadratic_non_residue_to_trace, F* ret) {
-  // Fins x such that x² = a.
-  // Here. modulus M is 2ˢ * T + 1. (where s is two adicity and T is trace).
-  // https://eprint.iacr.org/2012/685.pdf (page 12, algorithm 5)
+constexpr bool ComputeTonelliShanksSquareRootFromPower(
+    const F& a, F w, const F& quadratic_non_residue_to_trace, F* ret) {
   if (a.IsZero()) {
     *ret = F::Zero();
     return true;
@@ -30,7 +31,7 @@ constexpr bool ComputeTonelliShanksSquareRoot(
   // If we try
   // aᵀ * a = (a^((T + 1) / 2))^2
   // and if aᵀ is 1, then we can say the square root of a is a^((T + 1) / 2).
-  F w = a.Pow(F::Config::kTraceMinusOneDivTwo);
+  // Here, w = a^((T - 1) / 2).
   // x = aw = a^((T + 1) / 2)
   F x = w * a;
   // b = xw = aᵀ
@@ -108,6 +109,21 @@ constexpr bool ComputeTonelliShanksSquareRoot(
   return false;
 }
 
+template <typename F>
+constexpr bool ComputeTonelliShanksSquareRoot(
+    const F& a, const F& quadratic_non_residue_to_trace, F* ret) {
+  // Fins x such that x² = a.
+  // Here. modulus M is 2ˢ * T + 1. (where s is two adicity and T is trace).
+  // https://eprint.iacr.org/2012/685.pdf (page 12, algorithm 5)
+  if (a.IsZero()) {
+    *ret = F::Zero();
+    return true;
+  }
+  return ComputeTonelliShanksSquareRootFromPower(
+      a, a.Pow(F::Config::kTraceMinusOneDivTwo),
+      quadratic_non_residue_to_trace, ret);
+}
+
 }  // namespace tachyon::math
 
 #endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_TONELLI_SHANKS_H_
@@ -27,6 +27,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/math/finite_fields/field_kernels.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -98,28 +99,67 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
 
   [[nodiscard]] constexpr Evals FFT(const DensePoly& poly) const override {
     if (poly.IsZero()) return {};
+    return DoFFT(poly, GetRootsOfUnityForFFT());
+  }
+
+  [[nodiscard]] constexpr DensePoly IFFT(const Evals& evals) const override {
+    // NOTE(chokobole): This is not a faster check any more since
+    // https://github.com/kroma-network/tachyon/pull/104.
+    if (evals.IsZero()) return {};
+    return DoIFFT(evals, GetRootsOfUnityForIFFT());
+  }
+
+  // The roots of unity are computed once and shared by all the (I)FFTs.
+  [[nodiscard]] std::vector<Evals> FFTBatch(
+      absl::Span<const DensePoly> polys) const override {
+    std::vector<F> roots = GetRootsOfUnityForFFT();
+    std::vector<Evals> ret(polys.size());
+    this->ParallelizeBatch(polys.size(), [this, polys, &roots, &ret](size_t i) {
+      if (!polys[i].IsZero()) ret[i] = DoFFT(polys[i], roots);
+    });
+    return ret;
+  }
+
+  [[nodiscard]] std::vector<DensePoly> IFFTBatch(
+      absl::Span<const Evals> evals) const override {
+    std::vector<F> roots = GetRootsOfUnityForIFFT();
+    std::vector<DensePoly> ret(evals.size());
+    this->ParallelizeBatch(evals.size(), [this, evals, &roots, &ret](size_t i) {
+      if (!evals[i].IsZero()) ret[i] = DoIFFT(evals[i], roots);
+    });
+    return ret;
+  }
+
+  std::vector<F> GetRootsOfUnityForFFT() const {
+    return this->GetRootsOfUnity(this->size_ / 2, this->group_gen_);
+  }
 
+  std::vector<F> GetRootsOfUnityForIFFT() const {
+    return this->GetRootsOfUnity(this->size_ / 2, this->group_gen_inv_);
+  }
+
+  // |roots| must be the result of |GetRootsOfUnityForFFT()|.
+  constexpr Evals DoFFT(const DensePoly& poly,
+                        absl::Span<const F> roots) const {
     Evals evals;
     evals.evaluations_ = poly.coefficients_.coefficients_;
     if (evals.evaluations_.size() * kDegreeAwareFFTThresholdFactor <=
         this->size_) {
-      DegreeAwareFFTInPlace(evals);
+      DegreeAwareFFTInPlace(evals, roots);
     } else {
       evals.evaluations_.resize(this->size_, F::Zero());
-      InOrderFFTInPlace(evals);
+      InOrderFFTInPlace(evals, roots);
     }
     return evals;
   }
 
-  [[nodiscard]] constexpr DensePoly IFFT(const Evals& evals) const override {
-    // NOTE(chokobole): This is not a faster check any more since
-    // https://github.com/kroma-network/tachyon/pull/104.
-    if (evals.IsZero()) return {};
-
+  // |roots| must be the result of |GetRootsOfUnityForIFFT()|.
+  constexpr DensePoly DoIFFT(const Evals& evals,
+                             absl::Span<const F> roots) const {
     DensePoly poly;
     poly.coefficients_.coefficients_ = evals.evaluations_;
     poly.coefficients_.coefficients_.resize(this->size_, F::Zero());
-    InOrderIFFTInPlace(poly);
+    InOrderIFFTInPlace(poly, roots);
     poly.coefficients_.RemoveHighDegreeZeros();
     return poly;
   }
@@ -127,7 +167,8 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   // Degree aware FFT that runs in O(n log d) instead of O(n log n).
   // Implementation copied from libiop. (See
   // https://github.com/arkworks-rs/algebra/blob/master/poly/src/domain/radix2/fft.rs#L28)
-  constexpr void DegreeAwareFFTInPlace(Evals& evals) const {
+  constexpr void DegreeAwareFFTInPlace(Evals& evals,
+                                       absl::Span<const F> roots) const {
     if (!this->offset_.IsOne()) {
       Base::DistributePowers(evals, this->offset_);
     }
@@ -157,18 +198,20 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                                    });
     }
     size_t start_gap = duplicity_of_initials;
-    OutInHelper(evals, this->group_gen_, start_gap);
+    OutInHelper(evals, roots, start_gap);
   }
 
-  constexpr void InOrderFFTInPlace(Evals& evals) const {
+  constexpr void InOrderFFTInPlace(Evals& evals,
+                                   absl::Span<const F> roots) const {
     if (!this->offset_.IsOne()) {
       Base::DistributePowers(evals, this->offset_);
     }
-    FFTHelperInPlace(evals);
+    FFTHelperInPlace(evals, roots);
   }
 
-  constexpr void InOrderIFFTInPlace(DensePoly& poly) const {
-    IFFTHelperInPlace(poly);
+  constexpr void InOrderIFFTInPlace(DensePoly& poly,
+                                    absl::Span<const F> roots) const {
+    IFFTHelperInPlace(poly, roots);
     if (this->offset_.IsOne()) {
       // clang-format off
       OPENMP_PARALLEL_FOR(F& val : poly.coefficients_.coefficients_) {
@@ -181,18 +224,20 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     }
   }
 
-  constexpr void FFTHelperInPlace(Evals& evals) const {
+  constexpr void FFTHelperInPlace(Evals& evals,
+                                  absl::Span<const F> roots) const {
     uint32_t log_len = static_cast<uint32_t>(base::bits::Log2Ceiling(
         static_cast<uint32_t>(evals.evaluations_.size())));
     this->SwapElements(evals, evals.evaluations_.size() - 1, log_len);
-    OutInHelper(evals, this->group_gen_, 1);
+    OutInHelper(evals, roots, 1);
   }
 
   // Handles doing an IFFT with handling of being in order and out of order.
   // The results here must all be divided by |poly|, which is left up to the
   // caller to do.
-  constexpr void IFFTHelperInPlace(DensePoly& poly) const {
-    InOutHelper(poly, this->group_gen_inv_);
+  constexpr void IFFTHelperInPlace(DensePoly& poly,
+                                   absl::Span<const F> roots) const {
+    InOutHelper(poly, roots);
     uint32_t log_len = static_cast<uint32_t>(base::bits::Log2Ceiling(
         static_cast<uint32_t>(poly.coefficients_.coefficients_.size())));
     this->SwapElements(poly, poly.coefficients_.coefficients_.size() - 1,
@@ -204,6 +249,13 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                                        absl::Span<const F> roots, size_t step,
                                        size_t chunk_size, size_t thread_nums,
                                        size_t gap) {
+    const FieldKernels<F>& kernels = FieldKernels<F>::Get();
+    if (kernels.batch_butterfly_in_out && kernels.batch_butterfly_out_in) {
+      ApplyPackedButterfly<Order>(poly_or_evals, roots, step, chunk_size,
+                                  thread_nums, gap);
+      return;
+    }
+
     void (*fn)(F&, F&, const F&);
 
     if constexpr (Order == FFTOrder::kInOut) {
@@ -231,10 +283,54 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     }
   }
 
-  constexpr void InOutHelper(DensePoly& poly, const F& root) const {
-    std::vector<F> roots = this->GetRootsOfUnity(this->size_ / 2, root);
-    size_t step = 1;
-    bool first = true;
+  // Same as |ApplyButterfly()|, but applies the butterflies in batch with
+  // the SIMD kernels of |FieldKernels<F>|.
+  template <FFTOrder Order, typename PolyOrEvals>
+  static void ApplyPackedButterfly(PolyOrEvals& poly_or_evals,
+                                   absl::Span<const F> roots, size_t step,
+                                   size_t chunk_size, size_t thread_nums,
+                                   size_t gap) {
+    const FieldKernels<F>& kernels = FieldKernels<F>::Get();
+
+    // The butterflies whose roots are out of |roots| are skipped.
+    size_t num_butterflies = std::min(gap, (roots.size() + step - 1) / step);
+    if (num_butterflies == 0) return;
+    auto butterfly = [&poly_or_evals, &kernels, roots, step, gap](
+                         size_t i, size_t begin, size_t end) {
+      absl::Span<F> lo(poly_or_evals[i + begin], end - begin);
+      absl::Span<F> hi(poly_or_evals[i + begin + gap], end - begin);
+      if constexpr (Order == FFTOrder::kInOut) {
+        kernels.batch_butterfly_in_out(lo, hi, &roots[begin * step], step);
+      } else {
+        static_assert(Order == FFTOrder::kOutIn);
+        kernels.batch_butterfly_out_in(lo, hi, &roots[begin * step], step);
+      }
+    };
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < poly_or_evals.NumElements();
+                        i += chunk_size) {
+      // If the chunk is sufficiently big that parallelism helps,
+      // we parallelize the butterfly operation within the chunk.
+      if (gap > kMinGapSizeForParallelization && chunk_size < thread_nums) {
+        OPENMP_PARALLEL_FOR(size_t j = 0; j < num_butterflies;
+                            j += kMinGapSizeForParallelization) {
+          butterfly(i, j,
+                    std::min(j + kMinGapSizeForParallelization,
+                             num_butterflies));
+        }
+      } else {
+        butterfly(i, 0, num_butterflies);
+      }
+    }
+  }
+
+  // |roots_cache| must be the first |size_| / 2 powers of the root of unity.
+  constexpr void InOutHelper(DensePoly& poly,
+                             absl::Span<const F> roots_cache) const {
+    // See the comment in |OutInHelper()|.
+    size_t compaction_max_size =
+        std::min(roots_cache.size() / 2,
+                 roots_cache.size() / min_num_chunks_for_compaction_);
+    std::vector<F> compacted_roots(compaction_max_size, F::Zero());
 
 #if defined(TACHYON_HAS_OPENMP)
     size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
@@ -250,31 +346,28 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
 
       // Only compact roots to achieve cache locality/compactness if the roots
       // lookup is done a significant amount of times, which also implies a
-      // large lookup stride.
-      bool should_compact = num_chunks >= min_num_chunks_for_compaction_;
+      // large lookup stride. The roots are compacted from |roots_cache|, which
+      // is shared by the other IFFTs of |IFFTBatch()|.
+      bool should_compact =
+          num_chunks >= min_num_chunks_for_compaction_ && num_chunks > 1;
       if (should_compact) {
-        if (!first) {
-          size_t size = roots.size() / (step * 2);
-          OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
-            roots[i] = roots[i * (step * 2)];
-          }
-          roots.erase(roots.begin() + size, roots.end());
+        OPENMP_PARALLEL_FOR(size_t i = 0; i < gap; ++i) {
+          compacted_roots[i] = roots_cache[i * num_chunks];
         }
-        step = 1;
-      } else {
-        step = num_chunks;
       }
-      first = false;
-
-      ApplyButterfly<FFTOrder::kInOut>(poly, roots, step, chunk_size,
-                                       thread_nums, gap);
+      ApplyButterfly<FFTOrder::kInOut>(
+          poly,
+          should_compact ? absl::Span<const F>(compacted_roots.data(), gap)
+                         : roots_cache,
+          /*step=*/should_compact ? 1 : num_chunks, chunk_size, thread_nums,
+          gap);
       gap /= 2;
     }
   }
 
-  constexpr void OutInHelper(Evals& evals, const F& root,
+  // |roots_cache| must be the first |size_| / 2 powers of the root of unity.
+  constexpr void OutInHelper(Evals& evals, absl::Span<const F> roots_cache,
                              size_t start_gap) const {
-    std::vector<F> roots_cache = this->GetRootsOfUnity(this->size_ / 2, root);
     // The |std::min| is only necessary for the case where
     // |min_num_chunks_for_compaction_ = 1|. Else, notice that we compact the
     // |roots_cache| by a |step| of at least |min_num_chunks_for_compaction_|.
@@ -11,10 +11,13 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/bits.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/range.h"
+#include "tachyon/math/finite_fields/field_kernels.h"
 #include "tachyon/math/polynomials/evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
@@ -116,6 +119,27 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   // Compute an IFFT.
   [[nodiscard]] constexpr virtual DensePoly IFFT(const Evals& evals) const = 0;
 
+  // Compute FFTs of |polys|. See |ParallelizeBatch()| for how they are
+  // scheduled.
+  [[nodiscard]] virtual std::vector<Evals> FFTBatch(
+      absl::Span<const DensePoly> polys) const {
+    std::vector<Evals> ret(polys.size());
+    ParallelizeBatch(polys.size(),
+                     [this, polys, &ret](size_t i) { ret[i] = FFT(polys[i]); });
+    return ret;
+  }
+
+  // Compute IFFTs of |evals|. See |ParallelizeBatch()| for how they are
+  // scheduled.
+  [[nodiscard]] virtual std::vector<DensePoly> IFFTBatch(
+      absl::Span<const Evals> evals) const {
+    std::vector<DensePoly> ret(evals.size());
+    ParallelizeBatch(evals.size(), [this, evals, &ret](size_t i) {
+      ret[i] = IFFT(evals[i]);
+    });
+    return ret;
+  }
+
   // Computes the first |size| roots of unity for the entire domain.
   // e.g. for the domain [1, g, g², ..., gⁿ⁻¹}] and |size| = n / 2, it computes
   // [1, g, g², ..., g^{(n / 2) - 1}]
@@ -328,6 +352,38 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   }
 
  protected:
+  // The minimum size of a domain at which parallelizing a single (I)FFT is
+  // beneficial. This value was chosen empirically.
+  constexpr static size_t kMinSizeForFFTParallelization = size_t{1} << 12;
+
+  // Runs |fn(i)| for every i in [0, |num_polys|), where each call is an (I)FFT
+  // of a polynomial over this domain. Running (I)FFTs concurrently, each on a
+  // single thread, scales better than parallelizing each (I)FFT internally.
+  // So it is done for as many polynomials as the threads can evenly share, or
+  // for all of them if the domain is too small to parallelize a single
+  // (I)FFT. The remaining ones are run one by one with each (I)FFT being
+  // parallelized internally.
+  template <typename Fn>
+  void ParallelizeBatch(size_t num_polys, Fn&& fn) const {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    size_t num_concurrent_polys = num_polys;
+    if (size_ >= kMinSizeForFFTParallelization) {
+      num_concurrent_polys -= num_polys % thread_nums;
+    }
+    // NOTE: The parallel regions inside |fn| run on a single thread unless
+    // nested parallelism is enabled.
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_concurrent_polys; ++i) {
+      fn(i);
+    }
+    for (size_t i = num_concurrent_polys; i < num_polys; ++i) {
+      fn(i);
+    }
+  }
+
   // Multiply the i-th element of |poly_or_evals| with |c|*|g|ⁱ.
   template <typename PolyOrEvals>
   constexpr static void DistributePowersAndMulByConst(
@@ -342,6 +398,14 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
     size_t num_elems_per_thread = std::max(size / thread_nums, size_t{1024});
     OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += num_elems_per_thread) {
       F pow = c * g.Pow(i);
+      if (auto batch_distribute_powers =
+              FieldKernels<F>::Get().batch_distribute_powers) {
+        batch_distribute_powers(
+            absl::Span<F>(poly_or_evals[i],
+                          std::min(num_elems_per_thread, size - i)),
+            pow, g);
+        continue;
+      }
       for (size_t j = 0; j < num_elems_per_thread; ++j) {
         if (i + j >= size) break;
         (*poly_or_evals[i + j]) *= pow;
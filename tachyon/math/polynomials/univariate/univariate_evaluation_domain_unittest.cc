@@ -10,6 +10,7 @@
 #include "tachyon/base/functional/function_ref.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
 #include "tachyon/math/elliptic_curves/bn/bn384_small_two_adicity/fq.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
 #include "tachyon/math/polynomials/univariate/mixed_radix_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
 
@@ -49,6 +50,7 @@ class UnivariateEvaluationDomainTest : public testing::Test {
 
 using UnivariateEvaluationDomainTypes =
     testing::Types<Radix2EvaluationDomain<bls12_381::Fr>,
+                   Radix2EvaluationDomain<BabyBear>,
                    MixedRadixEvaluationDomain<bn384_small_two_adicity::Fq>>;
 TYPED_TEST_SUITE(UnivariateEvaluationDomainTest,
                  UnivariateEvaluationDomainTypes);
@@ -295,6 +297,65 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FFTCorrectness) {
   }
 }
 
+TYPED_TEST(UnivariateEvaluationDomainTest, FFTBatchCorrectness) {
+  using UnivariateEvaluationDomainType = TypeParam;
+  using F = typename UnivariateEvaluationDomainType::Field;
+  using BaseUnivariateEvaluationDomainType =
+      UnivariateEvaluationDomain<F, UnivariateEvaluationDomainType::kMaxDegree>;
+  using DensePoly = typename UnivariateEvaluationDomainType::DensePoly;
+  using Evals = typename UnivariateEvaluationDomainType::Evals;
+
+  const size_t log_domain_size = 6;
+  const size_t domain_size = size_t{1} << log_domain_size;
+  // Includes a zero polynomial and a polynomial small enough for the degree
+  // aware FFT.
+  std::vector<DensePoly> polys = {
+      DensePoly::Random(domain_size - 1), DensePoly(),
+      DensePoly::Random(domain_size / 8 - 1), DensePoly::Random(3),
+      DensePoly::Random(domain_size - 1)};
+  this->TestDomains(
+      domain_size, [&polys](const BaseUnivariateEvaluationDomainType& d) {
+        std::vector<Evals> evals_vec = d.FFTBatch(absl::MakeConstSpan(polys));
+        ASSERT_EQ(evals_vec.size(), polys.size());
+        for (size_t i = 0; i < polys.size(); ++i) {
+          EXPECT_EQ(evals_vec[i], d.FFT(polys[i]));
+        }
+        std::vector<DensePoly> polys_vec =
+            d.IFFTBatch(absl::MakeConstSpan(evals_vec));
+        ASSERT_EQ(polys_vec.size(), polys.size());
+        for (size_t i = 0; i < polys.size(); ++i) {
+          EXPECT_EQ(polys_vec[i], polys[i]);
+        }
+      });
+}
+
+TYPED_TEST(UnivariateEvaluationDomainTest, RootsCompaction) {
+  using UnivariateEvaluationDomainType = TypeParam;
+  using DensePoly = typename UnivariateEvaluationDomainType::DensePoly;
+  using Evals = typename UnivariateEvaluationDomainType::Evals;
+
+  if constexpr (std::is_same_v<UnivariateEvaluationDomainType,
+                               Radix2EvaluationDomain<bls12_381::Fr>>) {
+    const size_t domain_size = size_t{1} << 6;
+    DensePoly rand_poly = DensePoly::Random(domain_size - 1);
+    std::unique_ptr<UnivariateEvaluationDomainType> domain =
+        UnivariateEvaluationDomainType::Create(domain_size);
+    for (size_t min_num_chunks : {1, 2, 4, 128}) {
+      domain->set_min_num_chunks_for_compaction(min_num_chunks);
+      const auto& d = static_cast<
+          const typename TestFixture::BaseUnivariateEvaluationDomainType&>(
+          *domain);
+      Evals evals = d.FFT(rand_poly);
+      for (size_t i = 0; i < domain_size; ++i) {
+        EXPECT_EQ(*evals[i], rand_poly.Evaluate(d.GetElement(i)));
+      }
+      EXPECT_EQ(d.IFFT(evals), rand_poly);
+    }
+  } else {
+    GTEST_SKIP() << "Skip testing RootsCompaction on other domains";
+  }
+}
+
 // Test that the degree aware FFT (O(n log d)) matches the regular FFT
 // (O(n log n)).
 TYPED_TEST(UnivariateEvaluationDomainTest, DegreeAwareFFTCorrectness) {
@@ -139,6 +139,12 @@ class UnivariateEvaluations final
 
   std::string ToString() const { return base::VectorToString(evaluations_); }
 
+  // Each of the operators below makes a full pass over the evaluations, and
+  // the ones that aren't in place allocate a new vector. To combine several
+  // evaluations pointwise, e.g., a * b + c * d, compute every element in a
+  // single pass instead, as |CompressExpressions()| and
+  // |CircuitPolynomialBuilder| do.
+
   // AdditiveSemigroup methods
   UnivariateEvaluations& AddInPlace(const UnivariateEvaluations& other) {
     return internal::UnivariateEvaluationsOp<F, MaxDegree>::AddInPlace(*this,
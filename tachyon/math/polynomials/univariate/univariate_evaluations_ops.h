@@ -10,8 +10,12 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/finite_fields/field_kernels.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
 namespace tachyon::math {
@@ -22,6 +26,10 @@ class UnivariateEvaluationsOp {
  public:
   using Poly = UnivariateEvaluations<F, MaxDegree>;
 
+  // The minimum number of evaluations at which the packed multiplication is
+  // split across threads.
+  constexpr static size_t kMinSizeForParallelization = 1 << 10;
+
   static Poly& AddInPlace(Poly& self, const Poly& other) {
     std::vector<F>& l_evaluations = self.evaluations_;
     const std::vector<F>& r_evaluations = other.evaluations_;
@@ -73,6 +81,21 @@ class UnivariateEvaluationsOp {
       l_evaluations.clear();
       return self;
     }
+    if (auto batch_mul_in_place =
+            FieldKernels<F>::Get().batch_mul_in_place) {
+      absl::Span<F> l_span(l_evaluations.data(), r_evaluations.size());
+      base::Parallelize(
+          l_span,
+          [&r_evaluations, batch_mul_in_place](
+              absl::Span<F> chunk, size_t chunk_index, size_t chunk_size) {
+            batch_mul_in_place(
+                chunk,
+                absl::MakeConstSpan(&r_evaluations[chunk_index * chunk_size],
+                                    chunk.size()));
+          },
+          /*threshold=*/kMinSizeForParallelization);
+      return self;
+    }
     OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
       l_evaluations[i] *= r_evaluations[i];
     }
@@ -8,6 +8,7 @@
 #define TACHYON_ZK_BASE_COMMITMENTS_SHPLONK_EXTENSION_H_
 
 #include <utility>
+#include <vector>
 
 #include "tachyon/crypto/commitments/kzg/shplonk.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -58,6 +59,18 @@ class SHPlonkExtension
     return shplonk_.DoCommitLagrange(v, out);
   }
 
+  template <typename BaseContainersTy>
+  [[nodiscard]] bool DoCommitBatch(const BaseContainersTy& vs,
+                                   std::vector<Commitment>* outs) const {
+    return shplonk_.DoCommitBatch(vs, outs);
+  }
+
+  template <typename BaseContainersTy>
+  [[nodiscard]] bool DoCommitLagrangeBatch(
+      const BaseContainersTy& vs, std::vector<Commitment>* outs) const {
+    return shplonk_.DoCommitLagrangeBatch(vs, outs);
+  }
+
   template <typename ContainerTy, typename Proof>
   [[nodiscard]] bool DoCreateOpeningProof(const ContainerTy& poly_openings,
                                           Proof* proof) const {
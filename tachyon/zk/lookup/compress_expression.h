@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/parallelize.h"
 #include "tachyon/zk/expressions/evaluator/simple_evaluator.h"
 
 namespace tachyon::zk {
@@ -21,23 +22,22 @@ Evals CompressExpressions(
     const std::vector<std::unique_ptr<Expression<F>>>& expressions,
     const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl) {
   Evals compressed_value = domain->template Empty<Evals>();
-  Evals values = domain->template Empty<Evals>();
-
-  for (size_t expr_idx = 0; expr_idx < expressions.size(); ++expr_idx) {
-    base::Parallelize(
-        values.evaluations(),
-        [expr_idx, &expressions, &evaluator_tpl](
-            absl::Span<F> chunk, size_t chunk_index, size_t chunk_size) {
-          SimpleEvaluator<Evals> evaluator = evaluator_tpl;
-          evaluator.set_idx(chunk_index * chunk_size);
 
+  // NOTE: Each chunk is compressed over all the |expressions| at once, which
+  // takes a single pass over |compressed_value| without any temporaries.
+  base::Parallelize(
+      compressed_value.evaluations(),
+      [&expressions, &theta, &evaluator_tpl](
+          absl::Span<F> chunk, size_t chunk_index, size_t chunk_size) {
+        SimpleEvaluator<Evals> evaluator = evaluator_tpl;
+        for (const std::unique_ptr<Expression<F>>& expression : expressions) {
+          evaluator.set_idx(chunk_index * chunk_size);
           for (F& value : chunk) {
-            value = evaluator.Evaluate(expressions[expr_idx].get());
+            value *= theta;
+            value += evaluator.Evaluate(expression.get());
           }
-        });
-    compressed_value *= theta;
-    compressed_value += values;
-  }
+        }
+      });
   return compressed_value;
 }
 
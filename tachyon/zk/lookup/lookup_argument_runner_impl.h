@@ -10,6 +10,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/zk/lookup/compress_expression.h"
 #include "tachyon/zk/lookup/lookup_argument_runner.h"
 #include "tachyon/zk/plonk/circuit/rotation.h"
@@ -82,11 +84,14 @@ LookupEvaluated<Poly> LookupArgumentRunner<Poly, Evals>::EvaluateCommitted(
   BlindedPolynomial<Poly> permuted_table_poly =
       std::move(committed).TakePermutedTablePoly();
 
-  CHECK(prover->Evaluate(product_poly.poly(), x));
-  CHECK(prover->Evaluate(product_poly.poly(), x_next));
-  CHECK(prover->Evaluate(permuted_input_poly.poly(), x));
-  CHECK(prover->Evaluate(permuted_input_poly.poly(), x_inv));
-  CHECK(prover->Evaluate(permuted_table_poly.poly(), x));
+  std::vector<F> evals = {
+      product_poly.poly().Evaluate(x),
+      product_poly.poly().Evaluate(x_next),
+      permuted_input_poly.poly().Evaluate(x),
+      permuted_input_poly.poly().Evaluate(x_inv),
+      permuted_table_poly.poly().Evaluate(x),
+  };
+  CHECK(prover->GetWriter()->WriteManyToProof(absl::MakeConstSpan(evals)));
 
   return {
       std::move(permuted_input_poly),
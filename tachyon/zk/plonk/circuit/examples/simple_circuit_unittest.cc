@@ -2,6 +2,7 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/zk/plonk/circuit/examples/circuit_test.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
 #include "tachyon/zk/plonk/keys/proving_key.h"
@@ -627,6 +628,59 @@ TEST_F(SimpleCircuitTest, LoadProvingKey) {
   }
 }
 
+TEST_F(SimpleCircuitTest, LoadProvingKeyWithTablesFile) {
+  size_t n = 16;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F> circuit(constant, a, b);
+
+  ProvingKey<PCS> expected;
+  ASSERT_TRUE(expected.Load(prover_.get(), circuit));
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("pkey_tables");
+  ASSERT_TRUE(expected.WriteTablesFile(prover_.get(), path));
+
+  VerifyingKey<PCS> vkey;
+  ASSERT_TRUE(vkey.Load(prover_.get(), circuit));
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.LoadWithVerifyingKeyAndTablesFile(prover_.get(),
+                                                     std::move(vkey), path));
+  EXPECT_EQ(pkey.l_first(), expected.l_first());
+  EXPECT_EQ(pkey.l_last(), expected.l_last());
+  EXPECT_EQ(pkey.l_active_row(), expected.l_active_row());
+  EXPECT_EQ(pkey.fixed_columns(), expected.fixed_columns());
+  EXPECT_EQ(pkey.fixed_polys(), expected.fixed_polys());
+  EXPECT_EQ(pkey.permutation_proving_key(), expected.permutation_proving_key());
+  EXPECT_EQ(pkey.verifying_key().transcript_repr(),
+            expected.verifying_key().transcript_repr());
+
+  // A file for another circuit of the same shape is rejected.
+  SimpleCircuit<F> other_circuit(F(8), a, b);
+  VerifyingKey<PCS> other_vkey;
+  ASSERT_TRUE(other_vkey.Load(prover_.get(), other_circuit));
+  ASSERT_NE(other_vkey.transcript_repr(),
+            expected.verifying_key().transcript_repr());
+  ProvingKey<PCS> other_pkey;
+  EXPECT_FALSE(other_pkey.LoadWithVerifyingKeyAndTablesFile(
+      prover_.get(), std::move(other_vkey), path));
+
+  // A file for another size of the domain is rejected.
+  size_t n2 = 32;
+  CHECK(prover_->pcs().UnsafeSetup(n2, F(2)));
+  prover_->set_domain(Domain::Create(n2));
+  VerifyingKey<PCS> vkey2;
+  ASSERT_TRUE(vkey2.Load(prover_.get(), circuit));
+  ProvingKey<PCS> pkey2;
+  EXPECT_FALSE(pkey2.LoadWithVerifyingKeyAndTablesFile(prover_.get(),
+                                                       std::move(vkey2), path));
+}
+
 TEST_F(SimpleCircuitTest, Verify) {
   size_t n = 16;
   CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
@@ -9,6 +9,7 @@
 
 #include <utility>
 
+#include "absl/types/span.h"
 #include "openssl/blake2.h"
 
 #include "tachyon/crypto/transcripts/transcript.h"
@@ -97,6 +98,11 @@ class Blake2bReader : public crypto::TranscriptReader<AffinePointTy>,
   bool DoReadFromProof(ScalarField* scalar) const override {
     return ProofSerializer<ScalarField>::ReadFromProof(this->buffer_, scalar);
   }
+
+  bool DoReadManyFromProof(absl::Span<AffinePointTy> points) const override {
+    return ProofSerializer<AffinePointTy>::ReadManyFromProof(this->buffer_,
+                                                             points);
+  }
 };
 
 template <typename AffinePointTy>
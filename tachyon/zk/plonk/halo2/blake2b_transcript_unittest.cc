@@ -54,6 +54,23 @@ TEST_F(Blake2bTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Blake2bTranscriptTest, ReadMany) {
+  std::vector<G1AffinePoint> expected = {
+      G1AffinePoint::Random(), G1AffinePoint::Zero(), G1AffinePoint::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
+  ASSERT_TRUE(writer.WriteManyToProof(absl::MakeConstSpan(expected)));
+
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  Blake2bReader<G1AffinePoint> reader(std::move(read_buf));
+  std::vector<G1AffinePoint> actual(expected.size());
+  ASSERT_TRUE(reader.ReadManyFromProof(absl::MakeSpan(actual)));
+
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(writer.SqueezeChallenge(), reader.SqueezeChallenge());
+}
+
 TEST_F(Blake2bTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
@@ -10,6 +10,8 @@
 #include <array>
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/poseidon_sponge.h"
 #include "tachyon/zk/plonk/halo2/proof_serializer.h"
@@ -42,6 +44,11 @@ class PoseidonBase {
     return state_.Absorb(scalar);
   }
 
+  bool DoWriteManyToTranscript(absl::Span<const ScalarField> scalars) {
+    state_.AbsorbFieldElements(scalars);
+    return true;
+  }
+
   PoseidonSponge<ScalarField> state_;
 };
 
@@ -68,6 +75,12 @@ class PoseidonReader : public crypto::TranscriptReader<AffinePointTy>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  using crypto::TranscriptReader<AffinePointTy>::WriteManyToTranscript;
+
+  bool WriteManyToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoWriteManyToTranscript(scalars);
+  }
+
  private:
   bool DoReadFromProof(AffinePointTy* point) const override {
     return ProofSerializer<AffinePointTy>::ReadFromProof(this->buffer_, point);
@@ -76,6 +89,11 @@ class PoseidonReader : public crypto::TranscriptReader<AffinePointTy>,
   bool DoReadFromProof(ScalarField* scalar) const override {
     return ProofSerializer<ScalarField>::ReadFromProof(this->buffer_, scalar);
   }
+
+  bool DoReadManyFromProof(absl::Span<AffinePointTy> points) const override {
+    return ProofSerializer<AffinePointTy>::ReadManyFromProof(this->buffer_,
+                                                             points);
+  }
 };
 
 template <typename AffinePointTy>
@@ -99,6 +117,12 @@ class PoseidonWriter : public crypto::TranscriptWriter<AffinePointTy>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  using crypto::TranscriptWriter<AffinePointTy>::WriteManyToTranscript;
+
+  bool WriteManyToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoWriteManyToTranscript(scalars);
+  }
+
  private:
   bool DoWriteToProof(const AffinePointTy& point) override {
     return ProofSerializer<AffinePointTy>::WriteToProof(point, this->buffer_);
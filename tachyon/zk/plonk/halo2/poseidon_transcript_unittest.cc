@@ -54,6 +54,29 @@ TEST_F(PoseidonTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(PoseidonTranscriptTest, WriteMany) {
+  std::vector<G1AffinePoint> points = {G1AffinePoint::Random(),
+                                       G1AffinePoint::Random()};
+  std::vector<Fr> scalars = {Fr::Random(), Fr::Random(), Fr::Random()};
+
+  base::Uint8VectorBuffer write_buf;
+  PoseidonWriter<G1AffinePoint> writer(std::move(write_buf));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(writer.WriteToProof(scalar));
+  }
+
+  base::Uint8VectorBuffer write_buf2;
+  PoseidonWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  ASSERT_TRUE(writer2.WriteManyToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer2.WriteManyToProof(absl::MakeConstSpan(scalars)));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(), writer2.buffer().owned_buffer());
+  EXPECT_EQ(writer.SqueezeChallenge(), writer2.SqueezeChallenge());
+}
+
 TEST_F(PoseidonTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   PoseidonWriter<G1AffinePoint> writer(std::move(write_buf));
@@ -1,9 +1,12 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_PROOF_READER_H_
 #define TACHYON_ZK_PLONK_HALO2_PROOF_READER_H_
 
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/proof.h"
@@ -250,7 +253,14 @@ class ProofReader {
 
   template <typename T>
   std::vector<T> ReadMany(size_t n) {
-    return base::CreateVector(n, [this]() { return Read<T>(); });
+    if constexpr (std::is_same_v<T, C>) {
+      // Commitments are read at once so that they are decompressed in batch.
+      std::vector<C> commitments(n);
+      CHECK(transcript_->ReadManyFromProof(absl::MakeSpan(commitments)));
+      return commitments;
+    } else {
+      return base::CreateVector(n, [this]() { return Read<T>(); });
+    }
   }
 
   const VerifyingKey<PCSTy>& verifying_key_;
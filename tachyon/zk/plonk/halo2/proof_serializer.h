@@ -9,6 +9,9 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "tachyon/base/buffer/buffer.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
@@ -64,6 +67,43 @@ class ProofSerializer<math::AffinePoint<Curve>> {
     }
   }
 
+  // Reads |points.size()| compressed points at once. The square roots to
+  // decompress them are computed in batch. See
+  // |math::AffinePoint::BatchCreateFromX()|.
+  [[nodiscard]] static bool ReadManyFromProof(
+      const base::Buffer& buffer, absl::Span<math::AffinePoint<Curve>> points) {
+    std::vector<size_t> indices;
+    std::vector<BaseField> xs;
+    std::vector<bool> pick_odds;
+    indices.reserve(points.size());
+    xs.reserve(points.size());
+    pick_odds.reserve(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      uint8_t bytes[kByteSize];
+      if (!buffer.Read(bytes)) return false;
+      uint8_t is_odd = bytes[kByteSize - 1] >> 7;
+      bytes[kByteSize - 1] &= 0b01111111;
+      BaseField x = BaseField::FromBigInt(BigIntTy::FromBytesLE(bytes));
+      if (x.IsZero()) {
+        points[i] = math::AffinePoint<Curve>::Zero();
+      } else {
+        indices.push_back(i);
+        xs.push_back(std::move(x));
+        pick_odds.push_back(is_odd);
+      }
+    }
+
+    std::vector<math::AffinePoint<Curve>> decompressed(xs.size());
+    if (!math::AffinePoint<Curve>::BatchCreateFromX(
+            xs, pick_odds, absl::MakeSpan(decompressed))) {
+      return false;
+    }
+    for (size_t i = 0; i < indices.size(); ++i) {
+      points[indices[i]] = std::move(decompressed[i]);
+    }
+    return true;
+  }
+
   [[nodiscard]] static bool WriteToProof(const math::AffinePoint<Curve>& point,
                                          base::Buffer& buffer) {
     if (point.infinity()) {
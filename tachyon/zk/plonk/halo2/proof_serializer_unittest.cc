@@ -12,6 +12,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::halo2 {
@@ -95,4 +96,25 @@ TEST_F(ProofSerializerTest, SerializeProof) {
   }
 }
 
+TEST_F(ProofSerializerTest, ReadManyFromProof) {
+  std::vector<G1AffinePoint> expected = base::CreateVector(
+      100, []() { return G1AffinePoint::Random(); });
+  expected[3] = G1AffinePoint::Zero();
+
+  std::vector<uint8_t> buffer;
+  buffer.resize(expected.size() *
+                ProofSerializer<G1AffinePoint>::kByteSize);
+  base::Buffer write_buf(buffer.data(), buffer.size());
+  for (const G1AffinePoint& point : expected) {
+    ASSERT_TRUE(
+        ProofSerializer<G1AffinePoint>::WriteToProof(point, write_buf));
+  }
+
+  write_buf.set_buffer_offset(0);
+  std::vector<G1AffinePoint> actual(expected.size());
+  ASSERT_TRUE(ProofSerializer<G1AffinePoint>::ReadManyFromProof(
+      write_buf, absl::MakeSpan(actual)));
+  EXPECT_EQ(actual, expected);
+}
+
 }  // namespace tachyon::zk::halo2
@@ -9,6 +9,7 @@
 
 #include <utility>
 
+#include "absl/types/span.h"
 #include "openssl/sha.h"
 
 #include "tachyon/base/types/always_false.h"
@@ -97,6 +98,11 @@ class Sha256Reader : public crypto::TranscriptReader<AffinePointTy>,
   bool DoReadFromProof(ScalarField* scalar) const override {
     return ProofSerializer<ScalarField>::ReadFromProof(this->buffer_, scalar);
   }
+
+  bool DoReadManyFromProof(absl::Span<AffinePointTy> points) const override {
+    return ProofSerializer<AffinePointTy>::ReadManyFromProof(this->buffer_,
+                                                             points);
+  }
 };
 
 template <typename AffinePointTy>
@@ -7,14 +7,24 @@
 #ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 #define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/bits.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/math/base/big_int.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_argument.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_extended_parts.h"
 
 namespace tachyon::zk {
 
@@ -38,10 +48,18 @@ class ProvingKey : public Key<PCSTy> {
   const PermutationProvingKey<Poly, Evals>& permutation_proving_key() const {
     return permutation_proving_key_;
   }
+  const VanishingExtendedParts<Evals>& vanishing_extended_parts() const {
+    return vanishing_extended_parts_;
+  }
+  void set_vanishing_extended_parts(
+      VanishingExtendedParts<Evals>&& vanishing_extended_parts) {
+    vanishing_extended_parts_ = std::move(vanishing_extended_parts);
+  }
 
   // Return true if it is able to load from an instance of |circuit|.
   template <typename CircuitTy>
   [[nodiscard]] bool Load(ProverBase<PCSTy>* prover, const CircuitTy& circuit) {
+    vanishing_extended_parts_ = VanishingExtendedParts<Evals>();
     PreLoadResult pre_load_result;
     if (!this->PreLoad(prover, circuit, &pre_load_result)) return false;
     VerifyingKeyLoadResult vk_result;
@@ -56,13 +74,267 @@ class ProvingKey : public Key<PCSTy> {
   [[nodiscard]] bool LoadWithVerifyingKey(ProverBase<PCSTy>* prover,
                                           const CircuitTy& circuit,
                                           VerifyingKey<PCSTy>&& verifying_key) {
+    vanishing_extended_parts_ = VanishingExtendedParts<Evals>();
     PreLoadResult pre_load_result;
     if (!this->PreLoad(prover, circuit, &pre_load_result)) return false;
     verifying_key_ = std::move(verifying_key);
     return DoLoad(prover, std::move(pre_load_result), nullptr);
   }
 
+  // Writes the tables of this key to |path|, so that
+  // |LoadWithVerifyingKeyAndTablesFile()| can load them later without
+  // synthesizing the circuit nor running any (I)FFT. The file is laid out as
+  // below, where every table is n raw field elements in montgomery form and
+  // native endian, starting at a multiple of |kTablesFileAlignment|.
+  // Polynomials are padded with zeros up to n coefficients.
+  //
+  // | table               | count                |
+  // |---------------------|----------------------|
+  // | |TablesFileHeader|  | 1                    |
+  // | l_first(X)          | 1                    |
+  // | l_last(X)           | 1                    |
+  // | l_active_row(X)     | 1                    |
+  // | fixed columns       | #fixed columns       |
+  // | fixed polys         | #fixed columns       |
+  // | permutations        | #permutation columns |
+  // | permutation polys   | #permutation columns |
+  [[nodiscard]] bool WriteTablesFile(const ProverBase<PCSTy>* prover,
+                                     const base::FilePath& path) const {
+    size_t n = prover->pcs().N();
+    std::vector<absl::Span<const F>> tables = GetTables();
+    for (absl::Span<const F> table : tables) {
+      if (table.size() > n) {
+        LOG(ERROR) << "Tables must have at most " << n << " elements";
+        return false;
+      }
+    }
+    TablesFileHeader header = TablesFileHeader::Create(
+        n, fixed_columns_.size(),
+        permutation_proving_key_.permutations().size(),
+        verifying_key_.transcript_repr());
+
+    base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                              base::File::FLAG_READ | base::File::FLAG_WRITE);
+    if (!file.IsValid()) {
+      LOG(ERROR) << "Failed to create " << path.value();
+      return false;
+    }
+    base::MemoryMappedFile mapped;
+    if (!mapped.Initialize(std::move(file), {0, header.GetFileSize()},
+                           base::MemoryMappedFile::READ_WRITE_EXTEND)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    uint8_t* data = mapped.data();
+    memcpy(data, &header, sizeof(header));
+    size_t table_size = n * sizeof(F);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < tables.size(); ++i) {
+      uint8_t* dst = data + header.GetTableOffset(i);
+      size_t size = tables[i].size() * sizeof(F);
+      memcpy(dst, tables[i].data(), size);
+      memset(dst + size, 0, table_size - size);
+    }
+    return mapped.Flush();
+  }
+
+  // Loads the tables written by |WriteTablesFile()| from |path|, and uses
+  // |verifying_key| for the rest. The file is memory-mapped and each table is
+  // copied with a single memcpy, instead of being parsed element by element.
+  // Return false if the file was written for another field or for another
+  // verifying key, which is detected by its |transcript_repr()|.
+  [[nodiscard]] bool LoadWithVerifyingKeyAndTablesFile(
+      ProverBase<PCSTy>* prover, VerifyingKey<PCSTy>&& verifying_key,
+      const base::FilePath& path) {
+    using Coeffs = typename Poly::Coefficients;
+
+    vanishing_extended_parts_ = VanishingExtendedParts<Evals>();
+    base::MemoryMappedFile mapped;
+    if (!mapped.Initialize(path)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    if (mapped.length() < sizeof(TablesFileHeader)) {
+      LOG(ERROR) << "Tables file is too short";
+      return false;
+    }
+    TablesFileHeader header;
+    memcpy(&header, mapped.data(), sizeof(header));
+    if (!header.IsValid()) {
+      LOG(ERROR) << "Invalid or unsupported tables file";
+      return false;
+    }
+    size_t n = static_cast<size_t>(header.n);
+    if (n != prover->pcs().N()) {
+      LOG(ERROR) << "Tables file is for n = " << n << ", but "
+                 << prover->pcs().N() << " is expected";
+      return false;
+    }
+    if (mapped.length() != header.GetFileSize()) {
+      LOG(ERROR) << "Tables file has a wrong size";
+      return false;
+    }
+    const std::vector<AnyColumnKey>& permutation_columns =
+        verifying_key.constraint_system().permutation().columns();
+    if (header.num_fixed_columns !=
+            verifying_key.constraint_system().num_fixed_columns() ||
+        header.num_permutations != permutation_columns.size() ||
+        header.transcript_repr != verifying_key.transcript_repr()) {
+      LOG(ERROR) << "Tables file doesn't match the verifying key";
+      return false;
+    }
+
+    verifying_key_ = std::move(verifying_key);
+    prover->blinder().set_blinding_factors(
+        verifying_key_.constraint_system().ComputeBlindingFactors());
+
+    size_t num_fixed_columns = static_cast<size_t>(header.num_fixed_columns);
+    size_t num_permutations = static_cast<size_t>(header.num_permutations);
+    std::vector<Evals> permutations(num_permutations);
+    std::vector<Poly> permutation_polys(num_permutations);
+    fixed_columns_.resize(num_fixed_columns);
+    fixed_polys_.resize(num_fixed_columns);
+
+    const uint8_t* data = mapped.data();
+    auto get_table = [data, &header, n](size_t i) {
+      const F* begin =
+          reinterpret_cast<const F*>(data + header.GetTableOffset(i));
+      return std::vector<F>(begin, begin + n);
+    };
+    size_t num_tables = header.GetNumTables();
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_tables; ++i) {
+      std::vector<F> table = get_table(i);
+      if (i < 3) {
+        Poly& poly = i == 0 ? l_first_ : (i == 1 ? l_last_ : l_active_row_);
+        poly = Poly(Coeffs(std::move(table)));
+        continue;
+      }
+      size_t j = i - 3;
+      if (j < num_fixed_columns) {
+        fixed_columns_[j] = Evals(std::move(table));
+        continue;
+      }
+      j -= num_fixed_columns;
+      if (j < num_fixed_columns) {
+        fixed_polys_[j] = Poly(Coeffs(std::move(table)));
+        continue;
+      }
+      j -= num_fixed_columns;
+      if (j < num_permutations) {
+        permutations[j] = Evals(std::move(table));
+        continue;
+      }
+      j -= num_permutations;
+      permutation_polys[j] = Poly(Coeffs(std::move(table)));
+    }
+    permutation_proving_key_ = PermutationProvingKey<Poly, Evals>(
+        std::move(permutations), std::move(permutation_polys));
+
+    vanishing_argument_ =
+        VanishingArgument<F>::Create(verifying_key_.constraint_system());
+    return true;
+  }
+
+  // Precomputes the evaluations over the extended domain of the polynomials
+  // that don't change between proofs, so that the prover doesn't redo their
+  // FFTs in every proof. They are used only if the proof is created with the
+  // same |zeta|, and are dropped whenever this key is loaded again. This costs
+  // as much memory as (3 + #fixed + #permutation) evaluations over the
+  // extended domain.
+  void PrecomputeVanishingExtendedParts(const ProverBase<PCSTy>* prover,
+                                        const F& zeta) {
+    vanishing_extended_parts_ = VanishingExtendedParts<Evals>::Create(
+        prover->domain(), prover->extended_domain(),
+        verifying_key_.transcript_repr(), zeta, l_first_, l_last_,
+        l_active_row_, absl::MakeConstSpan(fixed_polys_),
+        absl::MakeConstSpan(permutation_proving_key_.polys()));
+  }
+
  private:
+  // The alignment of every table in the file written by |WriteTablesFile()|.
+  constexpr static size_t kTablesFileAlignment = 64;
+
+  struct TablesFileHeader {
+    constexpr static char kMagic[8] = "TCHYNPK";
+    constexpr static uint32_t kVersion = 1;
+
+    char magic[8];
+    uint32_t version;
+    // The size of a field element in bytes.
+    uint32_t field_size;
+    // The modulus of the field, which identifies it among the fields of the
+    // same size.
+    math::BigInt<F::N> modulus;
+    uint64_t n;
+    uint64_t num_fixed_columns;
+    uint64_t num_permutations;
+    // The |VerifyingKey::transcript_repr()| of the key that the tables belong
+    // to. It is a hash of the whole verifying key, so the tables of another
+    // circuit of the same shape are rejected.
+    F transcript_repr;
+
+    static TablesFileHeader Create(size_t n, size_t num_fixed_columns,
+                                   size_t num_permutations,
+                                   const F& transcript_repr) {
+      TablesFileHeader header;
+      memset(&header, 0, sizeof(header));
+      memcpy(header.magic, kMagic, sizeof(kMagic));
+      header.version = kVersion;
+      header.field_size = sizeof(F);
+      header.modulus = F::Config::kModulus;
+      header.n = n;
+      header.num_fixed_columns = num_fixed_columns;
+      header.num_permutations = num_permutations;
+      header.transcript_repr = transcript_repr;
+      return header;
+    }
+
+    bool IsValid() const {
+      return memcmp(magic, kMagic, sizeof(kMagic)) == 0 &&
+             version == kVersion && field_size == sizeof(F) &&
+             modulus == F::Config::kModulus;
+    }
+
+    size_t GetNumTables() const {
+      return 3 + 2 * num_fixed_columns + 2 * num_permutations;
+    }
+
+    size_t GetTableOffset(size_t i) const {
+      return base::bits::AlignUp(sizeof(TablesFileHeader),
+                                 kTablesFileAlignment) +
+             i * base::bits::AlignUp(n * sizeof(F), kTablesFileAlignment);
+    }
+
+    size_t GetFileSize() const { return GetTableOffset(GetNumTables()); }
+  };
+  static_assert(std::is_trivially_copyable_v<F>,
+                "The tables are copied as raw bytes");
+
+  // Returns the tables in the order of |WriteTablesFile()|.
+  std::vector<absl::Span<const F>> GetTables() const {
+    auto to_span = [](const std::vector<F>& values) {
+      return absl::MakeConstSpan(values);
+    };
+    std::vector<absl::Span<const F>> tables;
+    tables.reserve(3 + 2 * fixed_columns_.size() +
+                   2 * permutation_proving_key_.permutations().size());
+    tables.push_back(to_span(l_first_.coefficients().coefficients()));
+    tables.push_back(to_span(l_last_.coefficients().coefficients()));
+    tables.push_back(to_span(l_active_row_.coefficients().coefficients()));
+    for (const Evals& evals : fixed_columns_) {
+      tables.push_back(to_span(evals.evaluations()));
+    }
+    for (const Poly& poly : fixed_polys_) {
+      tables.push_back(to_span(poly.coefficients().coefficients()));
+    }
+    for (const Evals& evals : permutation_proving_key_.permutations()) {
+      tables.push_back(to_span(evals.evaluations()));
+    }
+    for (const Poly& poly : permutation_proving_key_.polys()) {
+      tables.push_back(to_span(poly.coefficients().coefficients()));
+    }
+    return tables;
+  }
+
   bool DoLoad(ProverBase<PCSTy>* prover, PreLoadResult&& pre_load_result,
               VerifyingKeyLoadResult* vk_load_result) {
     using Domain = typename PCSTy::Domain;
@@ -74,9 +346,7 @@ class ProvingKey : public Key<PCSTy> {
 
     const Domain* domain = prover->domain();
     fixed_columns_ = std::move(pre_load_result.fixed_columns);
-    fixed_polys_ = base::Map(fixed_columns_, [domain](const Evals& evals) {
-      return domain->IFFT(evals);
-    });
+    fixed_polys_ = domain->IFFTBatch(absl::MakeConstSpan(fixed_columns_));
 
     std::vector<Evals> permutations;
     if (vk_load_result) {
@@ -165,6 +435,7 @@ class ProvingKey : public Key<PCSTy> {
   std::vector<Poly> fixed_polys_;
   PermutationProvingKey<Poly, Evals> permutation_proving_key_;
   VanishingArgument<F> vanishing_argument_;
+  VanishingExtendedParts<Evals> vanishing_extended_parts_;
 };
 
 }  // namespace tachyon::zk
@@ -83,14 +83,8 @@ class VerifyingKey : public Key<PCSTy> {
       load_result->permutations = std::move(permutations);
     }
 
-    const PCSTy& pcs = entity->pcs();
-    // TODO(chokobole): Parallelize this.
-    fixed_commitments_ =
-        base::Map(pre_load_result.fixed_columns, [&pcs](const Evals& evals) {
-          Commitment commitment;
-          CHECK(pcs.CommitLagrange(evals, &commitment));
-          return commitment;
-        });
+    CHECK(entity->pcs().CommitLagrangeBatch(pre_load_result.fixed_columns,
+                                            &fixed_commitments_));
 
     SetTranscriptRepresentative(entity);
     return true;
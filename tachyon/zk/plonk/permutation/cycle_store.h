@@ -7,10 +7,12 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_CYCLE_STORE_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_CYCLE_STORE_H_
 
+#include <iterator>
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/permutation/label.h"
 
@@ -65,38 +67,54 @@ namespace tachyon::zk {
 // https://zcash.github.io/halo2/design/proving-system/permutation.html#algorithm.
 class TACHYON_EXPORT CycleStore {
  public:
+  // |Table| stores a value per (col, row) in a single flat vector, where the
+  // value at (col, row) is at |col * rows + row|.
   template <typename T>
   class Table {
    public:
     Table() = default;
-    explicit Table(std::vector<std::vector<T>>&& values)
-        : values_(std::move(values)) {}
+    Table(size_t rows, std::vector<T>&& values)
+        : rows_(rows), values_(std::move(values)) {
+      if (rows_ != 0) CHECK_EQ(values_.size() % rows_, size_t{0});
+    }
+    // |values[col][row]| is the value at (col, row).
+    explicit Table(std::vector<std::vector<T>>&& values) {
+      if (values.empty()) return;
+      rows_ = values[0].size();
+      values_.reserve(values.size() * rows_);
+      for (std::vector<T>& column : values) {
+        CHECK_EQ(column.size(), rows_);
+        values_.insert(values_.end(), std::make_move_iterator(column.begin()),
+                       std::make_move_iterator(column.end()));
+      }
+    }
 
-    T& operator[](const Label& l) { return values_[l.col][l.row]; }
-    const T& operator[](const Label& l) const { return values_[l.col][l.row]; }
+    T& operator[](const Label& l) { return values_[l.col * rows_ + l.row]; }
+    const T& operator[](const Label& l) const {
+      return values_[l.col * rows_ + l.row];
+    }
 
     bool operator==(const Table<T>& other) const {
-      return values_ == other.values_;
+      return rows_ == other.rows_ && values_ == other.values_;
     }
     bool operator!=(const Table<T>& other) const {
-      return values_ != other.values_;
+      return !operator==(other);
     }
 
     bool IsEmpty() const { return values_.empty(); }
 
    private:
-    std::vector<std::vector<T>> values_;
+    size_t rows_ = 0;
+    std::vector<T> values_;
   };
 
   CycleStore() = default;
   CycleStore(size_t cols, size_t rows) {
-    mapping_ = Table(base::CreateVector(cols, [rows](size_t col) {
-      return base::CreateVector(rows,
-                                [col](size_t row) { return Label(col, row); });
-    }));
+    mapping_ = Table(rows, base::CreateVector(cols * rows, [rows](size_t i) {
+                       return Label(i / rows, i % rows);
+                     }));
     aux_ = mapping_;
-    sizes_ =
-        Table(base::CreateVector(cols, base::CreateVector(rows, size_t{1})));
+    sizes_ = Table(rows, std::vector<size_t>(cols * rows, size_t{1}));
   }
 
   const Table<Label>& mapping() const { return mapping_; }
@@ -12,6 +12,19 @@
 
 namespace tachyon::zk {
 
+TEST(CycleStoreTest, Table) {
+  CycleStore::Table<size_t> table({{0, 1, 2}, {3, 4, 5}});
+  EXPECT_EQ(table, CycleStore::Table<size_t>(3, {0, 1, 2, 3, 4, 5}));
+  EXPECT_NE(table, CycleStore::Table<size_t>(2, {0, 1, 2, 3, 4, 5}));
+  for (size_t col = 0; col < 2; ++col) {
+    for (size_t row = 0; row < 3; ++row) {
+      EXPECT_EQ(table[Label(col, row)], col * 3 + row);
+    }
+  }
+  EXPECT_TRUE(CycleStore::Table<size_t>().IsEmpty());
+  EXPECT_TRUE(CycleStore(0, 3).sizes().IsEmpty());
+}
+
 TEST(CycleStoreTest, MergeCycle) {
   constexpr size_t kCols = 10;
   constexpr size_t kRows = 10;
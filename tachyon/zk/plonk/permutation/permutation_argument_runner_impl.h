@@ -11,6 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/plonk/circuit/rotation.h"
@@ -88,23 +91,25 @@ PermutationArgumentRunner<Poly, Evals>::EvaluateCommitted(
   std::vector<BlindedPolynomial<Poly>> product_polys =
       std::move(committed).TakeProductPolys();
 
+  F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
+  F x_last = Rotation(-(blinding_factors + 1)).RotateOmega(prover->domain(), x);
+
+  std::vector<F> evals;
+  evals.reserve(product_polys.size() * 3);
   for (size_t i = 0; i < product_polys.size(); ++i) {
     const Poly& poly = product_polys[i].poly();
 
-    CHECK(prover->Evaluate(poly, x));
-
-    F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
-    CHECK(prover->Evaluate(poly, x_next));
+    evals.push_back(poly.Evaluate(x));
+    evals.push_back(poly.Evaluate(x_next));
 
     // If we have any remaining sets to process, evaluate this set at ωᵘ
     // so we can constrain the last value of its running product to equal the
     // first value of the next set's running product, chaining them together.
     if (i != product_polys.size() - 1) {
-      F x_last =
-          Rotation(-(blinding_factors + 1)).RotateOmega(prover->domain(), x);
-      CHECK(prover->Evaluate(poly, x_last));
+      evals.push_back(poly.Evaluate(x_last));
     }
   }
+  CHECK(prover->GetWriter()->WriteManyToProof(absl::MakeConstSpan(evals)));
 
   return PermutationEvaluated<Poly>(std::move(product_polys));
 }
@@ -169,9 +174,9 @@ template <typename PCSTy, typename F>
 void PermutationArgumentRunner<Poly, Evals>::EvaluateProvingKey(
     ProverBase<PCSTy>* prover,
     const PermutationProvingKey<Poly, Evals>& proving_key, const F& x) {
-  for (const Poly& poly : proving_key.polys()) {
-    CHECK(prover->Evaluate(poly, x));
-  }
+  std::vector<F> evals = base::Map(
+      proving_key.polys(), [&x](const Poly& poly) { return poly.Evaluate(x); });
+  CHECK(prover->GetWriter()->WriteManyToProof(absl::MakeConstSpan(evals)));
 }
 
 template <typename Poly, typename Evals>
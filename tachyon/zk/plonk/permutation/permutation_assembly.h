@@ -10,8 +10,10 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
-#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/permutation/cycle_store.h"
@@ -44,11 +46,13 @@ class PermutationAssembly {
   // Constructor with permutation columns.
   PermutationAssembly(const std::vector<AnyColumnKey>& columns, size_t rows)
       : columns_(columns),
+        column_indices_(BuildColumnIndices(columns_)),
         cycle_store_(CycleStore(columns_.size(), rows)),
         rows_(rows) {}
 
   PermutationAssembly(std::vector<AnyColumnKey>&& columns, size_t rows)
       : columns_(std::move(columns)),
+        column_indices_(BuildColumnIndices(columns_)),
         cycle_store_(CycleStore(columns_.size(), rows)),
         rows_(rows) {}
 
@@ -57,6 +61,7 @@ class PermutationAssembly {
                                               size_t rows) {
     PermutationAssembly ret;
     ret.columns_ = std::move(columns);
+    ret.column_indices_ = BuildColumnIndices(ret.columns_);
     ret.cycle_store_ = std::move(cycle_store);
     ret.rows_ = rows;
     return ret;
@@ -82,13 +87,9 @@ class PermutationAssembly {
   constexpr PermutationVerifyingKey<PCSTy> BuildVerifyingKey(
       const Entity<PCSTy>* entity,
       const std::vector<Evals>& permutations) const {
-    const PCSTy& pcs = entity->pcs();
-    return PermutationVerifyingKey<PCSTy>(
-        base::Map(permutations, [pcs](const Evals& permutation) {
-          Commitment commitment;
-          CHECK(pcs.CommitLagrange(permutation, &commitment));
-          return commitment;
-        }));
+    Commitments commitments;
+    CHECK(entity->pcs().CommitLagrangeBatch(permutations, &commitments));
+    return PermutationVerifyingKey<PCSTy>(std::move(commitments));
   }
 
   // Returns the |PermutationProvingKey| that has the coefficient form and
@@ -99,12 +100,8 @@ class PermutationAssembly {
     const Domain* domain = prover->domain();
 
     // The polynomials of permutations with coefficients.
-    std::vector<Poly> polys;
-    polys.reserve(columns_.size());
-    for (size_t i = 0; i < columns_.size(); ++i) {
-      Poly poly = domain->IFFT(permutations[i]);
-      polys.push_back(std::move(poly));
-    }
+    std::vector<Poly> polys = domain->IFFTBatch(
+        absl::MakeConstSpan(permutations).first(columns_.size()));
 
     return PermutationProvingKey<Poly, Evals>(std::move(permutations),
                                               std::move(polys));
@@ -138,12 +135,27 @@ class PermutationAssembly {
   }
 
  private:
+  // Maps each column to its first index in |columns|.
+  static absl::flat_hash_map<AnyColumnKey, size_t> BuildColumnIndices(
+      const std::vector<AnyColumnKey>& columns) {
+    absl::flat_hash_map<AnyColumnKey, size_t> column_indices;
+    column_indices.reserve(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      column_indices.try_emplace(columns[i], i);
+    }
+    return column_indices;
+  }
+
   size_t GetColumnIndex(const AnyColumnKey& column) const {
-    return base::FindIndex(columns_, column).value();
+    auto it = column_indices_.find(column);
+    CHECK(it != column_indices_.end());
+    return it->second;
   }
 
   // Columns that participate on the copy permutation argument.
   std::vector<AnyColumnKey> columns_;
+  // Index of each column in |columns_|, which is looked up on every copy.
+  absl::flat_hash_map<AnyColumnKey, size_t> column_indices_;
   CycleStore cycle_store_;
   size_t rows_ = 0;
 };
@@ -4,8 +4,11 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/circuit/ref_table.h"
 
@@ -41,18 +44,33 @@ class Argument {
 
   // Generate a vector of advice coefficient-formed polynomials with a vector
   // of advice evaluation-formed columns. (a.k.a. Batch IFFT)
-  // And for memory optimization, every evaluations of advice will be released
-  // as soon as transforming it to coefficient form.
+  // And for memory optimization, the evaluations of advice are transformed by
+  // as many columns as the threads and released as soon as transforming them
+  // to coefficient form.
   void TransformAdvice(const Domain* domain) {
     CHECK(!advice_transformed_);
+#if defined(TACHYON_HAS_OPENMP)
+    size_t batch_size = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t batch_size = 1;
+#endif
     advice_polys_vec_ = base::Map(
-        advice_columns_vec_, [domain](std::vector<Evals>& advice_columns) {
-          return base::Map(advice_columns, [domain](Evals& advice_column) {
-            Poly poly = domain->IFFT(advice_column);
-            // Release advice evals for memory optimization.
-            advice_column = Evals::Zero();
-            return poly;
-          });
+        advice_columns_vec_,
+        [domain, batch_size](std::vector<Evals>& advice_columns) {
+          std::vector<Poly> advice_polys;
+          advice_polys.reserve(advice_columns.size());
+          for (size_t i = 0; i < advice_columns.size(); i += batch_size) {
+            absl::Span<Evals> batch =
+                absl::MakeSpan(advice_columns).subspan(i, batch_size);
+            std::vector<Poly> polys =
+                domain->IFFTBatch(absl::MakeConstSpan(batch));
+            for (size_t j = 0; j < batch.size(); ++j) {
+              advice_polys.push_back(std::move(polys[j]));
+              // Release advice evals for memory optimization.
+              batch[j] = Evals::Zero();
+            }
+          }
+          return advice_polys;
         });
     // Deallocate evaluations for memory optimization.
     advice_columns_vec_.clear();
@@ -132,19 +150,18 @@ class Argument {
       std::vector<std::vector<Evals>> instance_columns_vec) {
     return base::Map(instance_columns_vec,
                      [prover](const std::vector<Evals>& instance_columns) {
-                       return base::Map(
-                           instance_columns,
-                           [prover](const Evals& instance_column) {
-                             if constexpr (PCSTy::kQueryInstance) {
-                               CHECK(prover->CommitEvals(instance_column));
-                             } else {
-                               for (size_t i = 0; i < prover->pcs().N(); ++i) {
-                                 CHECK(prover->GetWriter()->WriteToTranscript(
-                                     *instance_column[i]));
-                               }
-                             }
-                             return prover->domain()->IFFT(instance_column);
-                           });
+                       for (const Evals& instance_column : instance_columns) {
+                         if constexpr (PCSTy::kQueryInstance) {
+                           CHECK(prover->CommitEvals(instance_column));
+                         } else {
+                           CHECK(prover->GetWriter()->WriteManyToTranscript(
+                               absl::MakeConstSpan(
+                                   instance_column.evaluations())
+                                   .first(prover->pcs().N())));
+                         }
+                       }
+                       return prover->domain()->IFFTBatch(
+                           absl::MakeConstSpan(instance_columns));
                      });
   }
 
@@ -10,7 +10,11 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/rational_field.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/constraint_system.h"
 #include "tachyon/zk/plonk/prover/witness_collection.h"
@@ -24,6 +28,7 @@ class Synthesizer {
   using Poly = typename PCSTy::Poly;
   using Evals = typename PCSTy::Evals;
   using RationalEvals = typename PCSTy::RationalEvals;
+  using Commitment = typename PCSTy::Commitment;
 
   Synthesizer() = default;
   Synthesizer(size_t num_circuits, const ConstraintSystem<F>* constraint_system)
@@ -39,6 +44,13 @@ class Synthesizer {
     }
   }
 
+  const std::vector<std::vector<Evals>>& advice_columns_vec() const {
+    return advice_columns_vec_;
+  }
+  const std::vector<std::vector<F>>& advice_blinds_vec() const {
+    return advice_blinds_vec_;
+  }
+
   // Synthesize circuit and store advice columns.
   template <typename CircuitTy>
   void GenerateAdviceColumns(
@@ -51,30 +63,41 @@ class Synthesizer {
         CircuitTy::Configure(empty_constraint_system);
 
     for (Phase current_phase : constraint_system_->GetPhases()) {
+      // Each circuit is synthesized into its own |WitnessCollection|, so the
+      // circuits are synthesized in parallel.
+      std::vector<std::vector<RationalEvals>> rational_advice_columns_vec(
+          num_circuits_);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_circuits_; ++i) {
+        rational_advice_columns_vec[i] = GenerateRationalAdvices(
+            prover, current_phase, instance_columns_vec[i], circuits[i],
+            config);
+      }
+
+      // Parse only indices related to the |current_phase|.
+      const std::vector<Phase>& phases =
+          constraint_system_->advice_column_phases();
+      std::vector<std::pair<size_t, size_t>> column_indices;
       for (size_t i = 0; i < num_circuits_; ++i) {
-        std::vector<RationalEvals> rational_advice_columns =
-            GenerateRationalAdvices(prover, current_phase,
-                                    instance_columns_vec[i], circuits[i],
-                                    config);
-
-        // Parse only indices related to the |current_phase|.
-        const std::vector<Phase>& phases =
-            constraint_system_->challenge_phases();
-        for (size_t j = 0; j < phases.size(); ++i) {
-          if (current_phase != phases[j]) continue;
-          const RationalEvals& column = rational_advice_columns[j];
-          std::vector<F> evaluated;
-          CHECK(math::RationalField<F>::BatchEvaluate(column.evaluations(),
-                                                      &evaluated));
-          // Add blinding factors to advice columns
-          evaluated[prover->pcs().N() - 1] = F::One();
-
-          Evals evaluated_evals(evaluated);
-          CHECK(prover->CommitEvals(evaluated_evals));
-          SetAdviceColumn(i, j, std::move(evaluated_evals),
-                          prover->blinder().Generate());
+        for (size_t j = 0; j < phases.size(); ++j) {
+          if (current_phase == phases[j]) column_indices.emplace_back(i, j);
         }
       }
+
+      std::vector<Evals> evaluated_columns = EvaluateRationalAdvices(
+          prover, rational_advice_columns_vec, column_indices);
+
+      // Commit to the columns in a single batch, and then write the
+      // commitments to the proof in order.
+      std::vector<Commitment> commitments;
+      CHECK(prover->pcs().CommitLagrangeBatch(evaluated_columns, &commitments));
+      CHECK(prover->GetWriter()->WriteManyToProof(
+          absl::MakeConstSpan(commitments)));
+
+      for (size_t i = 0; i < column_indices.size(); ++i) {
+        SetAdviceColumn(column_indices[i].first, column_indices[i].second,
+                        std::move(evaluated_columns[i]),
+                        prover->blinder().Generate());
+      }
       UpdateChallenges(prover, current_phase);
     }
   }
@@ -96,6 +119,46 @@ class Synthesizer {
     advice_blinds_vec_[circuit_idx][column_idx] = std::move(blind);
   }
 
+  // Evaluates the columns of |rational_advice_columns_vec| at
+  // |column_indices|, which are pairs of a circuit index and a column index.
+  // Every denominator of every column is inverted in a single batch.
+  std::vector<Evals> EvaluateRationalAdvices(
+      ProverBase<PCSTy>* prover,
+      const std::vector<std::vector<RationalEvals>>&
+          rational_advice_columns_vec,
+      const std::vector<std::pair<size_t, size_t>>& column_indices) {
+    size_t n = prover->pcs().N();
+    std::vector<absl::Span<const math::RationalField<F>>> columns =
+        base::Map(column_indices,
+                  [&rational_advice_columns_vec, n](
+                      const std::pair<size_t, size_t>& column_index) {
+                    const std::vector<math::RationalField<F>>& column =
+                        rational_advice_columns_vec[column_index.first]
+                                                   [column_index.second]
+                                                       .evaluations();
+                    CHECK_EQ(column.size(), n);
+                    return absl::MakeConstSpan(column);
+                  });
+
+    std::vector<F> denominators(columns.size() * n);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < denominators.size(); ++i) {
+      denominators[i] = columns[i / n][i % n].denominator();
+    }
+    CHECK(F::BatchInverseInPlace(denominators));
+
+    std::vector<Evals> evaluated_columns(columns.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < columns.size(); ++i) {
+      std::vector<F> evaluated(n);
+      for (size_t j = 0; j < n; ++j) {
+        evaluated[j] = columns[i][j].numerator() * denominators[i * n + j];
+      }
+      // Add blinding factors to advice columns
+      evaluated[n - 1] = F::One();
+      evaluated_columns[i] = Evals(std::move(evaluated));
+    }
+    return evaluated_columns;
+  }
+
   // Performs synthesis for a specific |circuit| and a specific |phase|, and
   // returns a vector of |RationalEvals|.
   template <typename CircuitTy>
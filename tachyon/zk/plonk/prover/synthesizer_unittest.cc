@@ -50,6 +50,20 @@ TEST_F(SynthesizerTest, GenerateAdviceColumns) {
                                      instance_columns_vec);
 
   std::vector<F> challenges = synthesizer_.ExportChallenges();
+
+  // The circuits are synthesized in parallel, but the results are stored in
+  // the order of the circuits.
+  const std::vector<std::vector<Evals>>& advice_columns_vec =
+      synthesizer_.advice_columns_vec();
+  ASSERT_EQ(advice_columns_vec.size(), circuits_.size());
+  for (const std::vector<Evals>& advice_columns : advice_columns_vec) {
+    ASSERT_EQ(advice_columns.size(),
+              verifying_key_.constraint_system().num_advice_columns());
+    for (const Evals& advice_column : advice_columns) {
+      EXPECT_EQ(advice_column.NumElements(), prover_->pcs().N());
+    }
+  }
+  EXPECT_EQ(advice_columns_vec[0], advice_columns_vec[1]);
 }
 
 }  // namespace tachyon::zk
@@ -68,6 +68,28 @@ class TACHYON_EXPORT Calculation {
   }
   bool operator!=(const Calculation& other) const { return !operator==(other); }
 
+  // Returns the |ValueSource|s that |Evaluate()| reads.
+  std::vector<ValueSource> GetValueSources() const {
+    switch (type_) {
+      case Type::kAdd:
+      case Type::kSub:
+      case Type::kMul:
+        return {pair().left, pair().right};
+      case Type::kSquare:
+      case Type::kDouble:
+      case Type::kNegate:
+      case Type::kStore:
+        return {value()};
+      case Type::kHorner: {
+        std::vector<ValueSource> ret = {horner().init, horner().factor};
+        ret.insert(ret.end(), horner().parts.begin(), horner().parts.end());
+        return ret;
+      }
+    }
+    NOTREACHED();
+    return {};
+  }
+
   template <typename Poly, typename Evals, typename F>
   F Evaluate(const EvaluationInput<Poly, Evals>& data,
              const std::vector<F>& constants, const F& previous_value) const {
@@ -6,6 +6,7 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 #define TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 
+#include <algorithm>
 #include <iostream>
 #include <utility>
 #include <vector>
@@ -17,13 +18,13 @@
 #include "tachyon/base/parallelize.h"
 #include "tachyon/zk/lookup/lookup_committed.h"
 #include "tachyon/zk/plonk/circuit/column_key.h"
-#include "tachyon/zk/plonk/circuit/owned_table.h"
 #include "tachyon/zk/plonk/circuit/ref_table.h"
 #include "tachyon/zk/plonk/circuit/rotation.h"
 #include "tachyon/zk/plonk/permutation/permutation_committed.h"
 #include "tachyon/zk/plonk/permutation/unpermuted_table.h"
 #include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_extended_parts.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
 
 namespace tachyon::zk {
@@ -58,6 +59,7 @@ class CircuitPolynomialBuilder {
       const std::vector<RefTable<Poly>>* poly_tables) {
     CircuitPolynomialBuilder builder;
     builder.domain_ = domain;
+    builder.extended_domain_ = extended_domain;
 
     builder.n_ = static_cast<int32_t>(n);
     builder.num_parts_ = extended_domain->size() >> domain->log_size_of_group();
@@ -78,6 +80,13 @@ class CircuitPolynomialBuilder {
     builder.delta_start_ = *beta * *zeta;
 
     builder.proving_key_ = proving_key;
+    const VanishingExtendedParts<Evals>& extended_parts =
+        proving_key->vanishing_extended_parts();
+    if (extended_parts.CanBeUsedFor(
+            proving_key->verifying_key().transcript_repr(), *zeta,
+            builder.num_parts_)) {
+      builder.extended_parts_ = &extended_parts;
+    }
     builder.committed_permutations_ = committed_permutations;
     builder.committed_lookups_vec_ = committed_lookups_vec;
     builder.poly_tables_ = poly_tables;
@@ -94,37 +103,50 @@ class CircuitPolynomialBuilder {
   ExtendedEvals BuildExtendedCircuitColumn(
       const GraphEvaluator<F>& custom_gate_evaluator,
       const std::vector<GraphEvaluator<F>>& lookup_evaluators) {
-    std::vector<std::vector<F>> value_parts;
-    value_parts.reserve(num_parts_);
-    // Calculate the quotient polynomial for each part
-    for (size_t i = 0; i < num_parts_; ++i) {
-      UpdateVanishingProvingKey();
-
-      std::vector<F> value_part =
-          base::CreateVector(static_cast<size_t>(n_), F::Zero());
-      size_t circuit_num = poly_tables_->size();
-      for (size_t j = 0; j < circuit_num; ++j) {
-        UpdateVanishingTable(j);
-        UpdateValuesByCustomGates(custom_gate_evaluator, value_part);
-
-        // Do iff there are permutation constraints.
-        if ((*committed_permutations_)[j].product_polys().size() > 0) {
-          UpdateVanishingPermutation(j);
-          UpdateValuesByPermutation(value_part);
-        }
-        if ((*committed_lookups_vec_)[j].size() > 0) {
-          UpdateVanishingLookups(j);
-          UpdateValuesByLookups(lookup_evaluators, value_part);
-        }
-      }
-      value_parts.push_back(std::move(value_part));
-      UpdateCurrentExtendedOmega();
-    }
-    std::vector<F> extended =
-        BuildExtendedColumnWithColumns(std::move(value_parts));
+    // Each part is written to its interleaved positions in |extended| as soon
+    // as it's done, so that the parts don't need to be transposed at the end.
+    std::vector<F> extended(num_parts_ * static_cast<size_t>(n_));
+    BuildExtendedCircuitParts(
+        custom_gate_evaluator, lookup_evaluators,
+        [this, &extended](const Evals& value_part, size_t part_idx) {
+          InterleaveExtendedPart(absl::MakeConstSpan(value_part.evaluations()),
+                                 part_idx, num_parts_,
+                                 absl::MakeSpan(extended));
+        });
     return ExtendedEvals(std::move(extended));
   }
 
+  // Returns the first |num_coeffs| coefficients of the quotient polynomial
+  // h(X), which is the circuit polynomial divided by the vanishing polynomial.
+  // These are the same as what |BuildExtendedCircuitColumn()|,
+  // |DivideByVanishingPolyInPlace()| and |ExtendedToCoeff()| give in a row.
+  // But each part is divided and interpolated as soon as it's evaluated, so
+  // that the extended circuit column is never materialized and the peak memory
+  // is O(n * (#columns + |num_coeffs| / n)) instead of O(extended_n *
+  // #columns). In return, it takes O(|num_parts_| * |num_coeffs|) more field
+  // operations to combine the parts.
+  std::vector<F> BuildQuotientPolyCoeffs(
+      const GraphEvaluator<F>& custom_gate_evaluator,
+      const std::vector<GraphEvaluator<F>>& lookup_evaluators,
+      size_t num_coeffs) {
+    // The evaluations of the vanishing polynomial are the same over a part.
+    const std::vector<F> t_evaluations_inv =
+        ComputeVanishingPolyInverses<F>(extended_domain_, domain_);
+    std::vector<F> coeffs(num_coeffs, F::Zero());
+    // The coefficients beyond the size of the extended domain are zeros.
+    absl::Span<F> extended_coeffs = absl::MakeSpan(coeffs).subspan(
+        0, std::min(num_coeffs, extended_domain_->size()));
+    BuildExtendedCircuitParts(
+        custom_gate_evaluator, lookup_evaluators,
+        [this, &t_evaluations_inv, extended_coeffs](const Evals& value_part,
+                                                    size_t part_idx) {
+          AccumulateExtendedPartToCoeffs(domain_, extended_domain_, value_part,
+                                         part_idx, t_evaluations_inv[part_idx],
+                                         extended_coeffs);
+        });
+    return coeffs;
+  }
+
   void UpdateValuesByLookups(
       const std::vector<GraphEvaluator<F>>& lookup_evaluators,
       std::vector<F>& values) {
@@ -137,6 +159,9 @@ class CircuitPolynomialBuilder {
         const Evals& input_coset = lookup_input_cosets_[i];
         const Evals& table_coset = lookup_input_cosets_[i];
         const Evals& product_coset = lookup_product_cosets_[i];
+        const Evals& l_first = *l_first_;
+        const Evals& l_last = *l_last_;
+        const Evals& l_active_row = *l_active_row_;
 
         EvaluationInput<Poly, Evals> evaluation_input = ExtractEvaluationInput(
             ev.CreateInitialIntermediates(), ev.CreateEmptyRotations());
@@ -155,12 +180,12 @@ class CircuitPolynomialBuilder {
 
           // l_first(X) * (1 - z(X)) = 0
           chunk[j] *= *y_;
-          chunk[j] += (one_ - *product_coset[idx]) * *l_first_[idx];
+          chunk[j] += (one_ - *product_coset[idx]) * *l_first[idx];
 
           // l_last(X) * (z(X)² - z(X)) = 0
           chunk[j] *= *y_;
           chunk[j] += (product_coset[idx]->Square() - *product_coset[idx]) *
-                      *l_last_[idx];
+                      *l_last[idx];
 
           // clang-format off
           // A * (B - C) = 0 where
@@ -172,13 +197,13 @@ class CircuitPolynomialBuilder {
           chunk[j] += (*product_coset[r_next] * (*input_coset[idx] + *beta_) *
                            (*table_coset[idx] + *gamma_) -
                        *product_coset[idx] * table_value) *
-                      *l_active_row_[idx];
+                      *l_active_row[idx];
 
           // Check that the first values in the permuted input expression and
           // permuted fixed expression are the same.
           // l_first(X) * (a'(X) - s'(X)) = 0
           chunk[j] *= *y_;
-          chunk[j] += a_minus_s * *l_first_[idx];
+          chunk[j] += a_minus_s * *l_first[idx];
 
           // Check that each value in the permuted lookup input expression is
           // either equal to the value above it, or the value at the same
@@ -186,7 +211,7 @@ class CircuitPolynomialBuilder {
           // (a′(X) − s′(X))⋅(a′(X) − a′(w⁻¹X)) = 0
           chunk[j] *= *y_;
           chunk[j] += a_minus_s * (*input_coset[idx] - *input_coset[r_prev]) *
-                      *l_active_row_[idx];
+                      *l_active_row[idx];
         }
       });
     }
@@ -196,7 +221,10 @@ class CircuitPolynomialBuilder {
     base::Parallelize(values, [this](absl::Span<F> chunk, size_t chunk_offset,
                                      size_t chunk_size) {
       const std::vector<Evals>& product_cosets = permutation_product_cosets_;
-      const std::vector<Evals>& cosets = permutation_cosets_;
+      const std::vector<Evals>& cosets = *permutation_cosets_;
+      const Evals& l_first = *l_first_;
+      const Evals& l_last = *l_last_;
+      const Evals& l_active_row = *l_active_row_;
 
       size_t start = chunk_offset * chunk_size;
       F beta_term = current_extended_omega_ * omega_->Pow(start);
@@ -205,13 +233,13 @@ class CircuitPolynomialBuilder {
 
         // Enforce only for the first set: l_first(X) * (1 - z₀(X)) = 0
         chunk[i] *= *y_;
-        chunk[i] += (one_ - *product_cosets.front()[idx]) * *l_first_[idx];
+        chunk[i] += (one_ - *product_cosets.front()[idx]) * *l_first[idx];
 
         // Enforce only for the last set: l_last(X) * (z_l(X)² - z_l(X)) = 0
         const Evals& last_coset = product_cosets.back();
         chunk[i] *= *y_;
         chunk[i] +=
-            *l_last_[idx] * (last_coset[idx]->Square() - *last_coset[idx]);
+            *l_last[idx] * (last_coset[idx]->Square() - *last_coset[idx]);
 
         // Except for the first set, enforce:
         // l_first(X) * (zᵢ(X) - zᵢ₋₁(w⁻¹X)) = 0
@@ -219,7 +247,7 @@ class CircuitPolynomialBuilder {
         for (size_t set_idx = 0; set_idx < product_cosets.size(); ++set_idx) {
           if (set_idx == 0) continue;
           chunk[i] *= *y_;
-          chunk[i] += *l_first_[idx] * (*product_cosets[set_idx][idx] -
+          chunk[i] += *l_first[idx] * (*product_cosets[set_idx][idx] -
                                         *product_cosets[set_idx - 1][r_last]);
         }
 
@@ -250,7 +278,7 @@ class CircuitPolynomialBuilder {
           F right = CalculateRight(column_chunk, &current_delta, idx,
                                    product_cosets[j][idx]);
           chunk[i] *= *y_;
-          chunk[i] += (left - right) * *l_active_row_[idx];
+          chunk[i] += (left - right) * *l_active_row[idx];
         }
         beta_term *= *omega_;
       }
@@ -258,6 +286,178 @@ class CircuitPolynomialBuilder {
   }
 
  private:
+  // The step of |BuildExtendedCircuitColumn()| that reads a column, in the
+  // order they are run.
+  enum class ColumnConsumer {
+    kNone,
+    kCustomGates,
+    kPermutation,
+    kLookups,
+  };
+
+  // Evaluates the circuit polynomial over each part of the extended domain in
+  // order and calls |callback(value_part, part_idx)| with the evaluations over
+  // the part. |value_part| is reused for the next part once |callback|
+  // returns.
+  template <typename Callback>
+  void BuildExtendedCircuitParts(
+      const GraphEvaluator<F>& custom_gate_evaluator,
+      const std::vector<GraphEvaluator<F>>& lookup_evaluators,
+      Callback callback) {
+    ComputeLastConsumers(custom_gate_evaluator, lookup_evaluators);
+
+    Evals value_part(std::vector<F>(static_cast<size_t>(n_)));
+    std::vector<F>& values = value_part.evaluations();
+    // Calculate the quotient polynomial for each part
+    for (size_t i = 0; i < num_parts_; ++i) {
+      UpdateVanishingProvingKey(i);
+
+      base::Parallelize(values, [](absl::Span<F> chunk) {
+        std::fill(chunk.begin(), chunk.end(), F::Zero());
+      });
+      size_t circuit_num = poly_tables_->size();
+      for (size_t j = 0; j < circuit_num; ++j) {
+        UpdateVanishingTable(i, j);
+        UpdateValuesByCustomGates(custom_gate_evaluator, values);
+        ReleaseColumns(ColumnConsumer::kCustomGates);
+
+        // Do iff there are permutation constraints.
+        if ((*committed_permutations_)[j].product_polys().size() > 0) {
+          UpdateVanishingPermutation(i, j);
+          UpdateValuesByPermutation(values);
+          permutation_product_cosets_.clear();
+        }
+        ReleaseColumns(ColumnConsumer::kPermutation);
+
+        if ((*committed_lookups_vec_)[j].size() > 0) {
+          UpdateVanishingLookups(j);
+          UpdateValuesByLookups(lookup_evaluators, values);
+          lookup_product_cosets_.clear();
+          lookup_input_cosets_.clear();
+          lookup_table_cosets_.clear();
+        }
+        ReleaseColumns(ColumnConsumer::kLookups);
+      }
+      callback(static_cast<const Evals&>(value_part), i);
+      UpdateCurrentExtendedOmega();
+    }
+  }
+
+  // Updates |last_consumers| with |consumer| for the columns marked in
+  // |queried|.
+  static void UpdateLastConsumers(const std::vector<bool>& queried,
+                                  ColumnConsumer consumer,
+                                  std::vector<ColumnConsumer>& last_consumers) {
+    for (size_t i = 0; i < queried.size(); ++i) {
+      if (queried[i]) last_consumers[i] = consumer;
+    }
+  }
+
+  // Finds out which step reads each column last. The columns that are never
+  // read are not converted to the extended parts at all, and the others are
+  // released as soon as their last consumer is done.
+  void ComputeLastConsumers(
+      const GraphEvaluator<F>& custom_gate_evaluator,
+      const std::vector<GraphEvaluator<F>>& lookup_evaluators) {
+    if (poly_tables_->empty()) return;
+    const RefTable<Poly>& poly_table = (*poly_tables_)[0];
+    size_t num_fixed_columns = poly_table.fixed_columns().size();
+    size_t num_advice_columns = poly_table.advice_columns().size();
+    size_t num_instance_columns = poly_table.instance_columns().size();
+    fixed_last_consumers_ =
+        std::vector<ColumnConsumer>(num_fixed_columns, ColumnConsumer::kNone);
+    advice_last_consumers_ =
+        std::vector<ColumnConsumer>(num_advice_columns, ColumnConsumer::kNone);
+    instance_last_consumers_ = std::vector<ColumnConsumer>(
+        num_instance_columns, ColumnConsumer::kNone);
+
+    auto update = [this, num_fixed_columns, num_advice_columns,
+                   num_instance_columns](
+                      ColumnConsumer consumer,
+                      absl::Span<const GraphEvaluator<F>> evaluators,
+                      absl::Span<const AnyColumnKey> column_keys) {
+      std::vector<bool> fixed_queried(num_fixed_columns);
+      std::vector<bool> advice_queried(num_advice_columns);
+      std::vector<bool> instance_queried(num_instance_columns);
+      for (const GraphEvaluator<F>& evaluator : evaluators) {
+        evaluator.MarkQueriedColumns(&fixed_queried, &advice_queried,
+                                     &instance_queried);
+      }
+      for (const AnyColumnKey& column_key : column_keys) {
+        switch (column_key.type()) {
+          case ColumnType::kFixed:
+            fixed_queried[column_key.index()] = true;
+            break;
+          case ColumnType::kAdvice:
+            advice_queried[column_key.index()] = true;
+            break;
+          case ColumnType::kInstance:
+            instance_queried[column_key.index()] = true;
+            break;
+          case ColumnType::kAny:
+            NOTREACHED();
+            break;
+        }
+      }
+      UpdateLastConsumers(fixed_queried, consumer, fixed_last_consumers_);
+      UpdateLastConsumers(advice_queried, consumer, advice_last_consumers_);
+      UpdateLastConsumers(instance_queried, consumer,
+                          instance_last_consumers_);
+    };
+    update(ColumnConsumer::kCustomGates,
+           absl::Span<const GraphEvaluator<F>>(&custom_gate_evaluator, 1), {});
+    update(ColumnConsumer::kPermutation, {},
+           absl::MakeConstSpan(proving_key_->verifying_key()
+                                   .constraint_system()
+                                   .permutation()
+                                   .columns()));
+    update(ColumnConsumer::kLookups, absl::MakeConstSpan(lookup_evaluators),
+           {});
+  }
+
+  // Converts the columns of |polys| that are read by any step to the current
+  // extended part. The others are left empty.
+  std::vector<Evals> CoeffsToQueriedExtendedPart(
+      absl::Span<const Poly> polys,
+      const std::vector<ColumnConsumer>& last_consumers) const {
+    std::vector<Evals> ret(polys.size());
+    // The consecutive queried columns are converted in a batch.
+    size_t begin = 0;
+    while (begin < polys.size()) {
+      if (last_consumers[begin] == ColumnConsumer::kNone) {
+        ++begin;
+        continue;
+      }
+      size_t end = begin + 1;
+      while (end < polys.size() &&
+             last_consumers[end] != ColumnConsumer::kNone) {
+        ++end;
+      }
+      std::vector<Evals> evals_vec =
+          CoeffsToExtendedPart(domain_, polys.subspan(begin, end - begin),
+                               *zeta_, current_extended_omega_);
+      std::move(evals_vec.begin(), evals_vec.end(), ret.begin() + begin);
+      begin = end;
+    }
+    return ret;
+  }
+
+  // Releases the extended parts of the columns whose last consumer is
+  // |consumer|.
+  void ReleaseColumns(ColumnConsumer consumer) {
+    auto release = [consumer](
+                       const std::vector<ColumnConsumer>& last_consumers,
+                       std::vector<Evals>& columns) {
+      // NOTE: |columns| is empty if it is not owned.
+      for (size_t i = 0; i < columns.size(); ++i) {
+        if (last_consumers[i] == consumer) columns[i] = Evals();
+      }
+    };
+    release(fixed_last_consumers_, owned_fixed_columns_);
+    release(advice_last_consumers_, advice_columns_);
+    release(instance_last_consumers_, instance_columns_);
+  }
+
   EvaluationInput<Poly, Evals> ExtractEvaluationInput(
       std ::vector<F>&& intermediates, std::vector<int32_t>&& rotations) {
     return EvaluationInput<Poly, Evals>(
@@ -305,25 +505,40 @@ class CircuitPolynomialBuilder {
     });
   }
 
-  void UpdateVanishingProvingKey() {
-    l_first_ = CoeffToExtendedPart(domain_, proving_key_->l_first(), *zeta_,
-                                   current_extended_omega_);
-    l_last_ = CoeffToExtendedPart(domain_, proving_key_->l_last(), *zeta_,
-                                  current_extended_omega_);
-    l_active_row_ = CoeffToExtendedPart(domain_, proving_key_->l_active_row(),
-                                        *zeta_, current_extended_omega_);
+  void UpdateVanishingProvingKey(size_t part_idx) {
+    if (extended_parts_) {
+      l_first_ = &extended_parts_->l_first_parts()[part_idx];
+      l_last_ = &extended_parts_->l_last_parts()[part_idx];
+      l_active_row_ = &extended_parts_->l_active_row_parts()[part_idx];
+      return;
+    }
+    owned_l_first_ = CoeffToExtendedPart(domain_, proving_key_->l_first(),
+                                         *zeta_, current_extended_omega_);
+    owned_l_last_ = CoeffToExtendedPart(domain_, proving_key_->l_last(), *zeta_,
+                                        current_extended_omega_);
+    owned_l_active_row_ =
+        CoeffToExtendedPart(domain_, proving_key_->l_active_row(), *zeta_,
+                            current_extended_omega_);
+    l_first_ = &owned_l_first_;
+    l_last_ = &owned_l_last_;
+    l_active_row_ = &owned_l_active_row_;
   }
 
-  void UpdateVanishingPermutation(size_t circuit_idx) {
+  void UpdateVanishingPermutation(size_t part_idx, size_t circuit_idx) {
     permutation_product_cosets_ = CoeffsToExtendedPart(
         domain_,
         absl::MakeConstSpan(
             (*committed_permutations_)[circuit_idx].product_polys()),
         *zeta_, current_extended_omega_);
-    permutation_cosets_ = CoeffsToExtendedPart(
+    if (extended_parts_) {
+      permutation_cosets_ = &extended_parts_->permutations_parts()[part_idx];
+      return;
+    }
+    owned_permutation_cosets_ = CoeffsToExtendedPart(
         domain_,
         absl::MakeConstSpan(proving_key_->permutation_proving_key().polys()),
         *zeta_, current_extended_omega_);
+    permutation_cosets_ = &owned_permutation_cosets_;
   }
 
   void UpdateVanishingLookups(size_t circuit_idx) {
@@ -349,23 +564,34 @@ class CircuitPolynomialBuilder {
     }
   }
 
-  void UpdateVanishingTable(size_t circuit_idx) {
-    std::vector<Evals> fixed_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].fixed_columns(), *zeta_,
-        current_extended_omega_);
-    std::vector<Evals> advice_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].advice_columns(), *zeta_,
-        current_extended_omega_);
-    std::vector<Evals> instance_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].instance_columns(), *zeta_,
-        current_extended_omega_);
-    table_ =
-        OwnedTable<Evals>(std::move(fixed_columns), std::move(advice_columns),
-                          std::move(instance_columns));
+  void UpdateVanishingTable(size_t part_idx, size_t circuit_idx) {
+    const RefTable<Poly>& poly_table = (*poly_tables_)[circuit_idx];
+    absl::Span<const Evals> fixed_columns;
+    // The cached parts are used only if the fixed columns of the table are
+    // the |fixed_polys()| of |proving_key_|.
+    if (extended_parts_ && poly_table.fixed_columns().data() ==
+                               proving_key_->fixed_polys().data()) {
+      owned_fixed_columns_.clear();
+      fixed_columns =
+          absl::MakeConstSpan(extended_parts_->fixed_columns_parts()[part_idx]);
+    } else {
+      owned_fixed_columns_ = CoeffsToQueriedExtendedPart(
+          poly_table.fixed_columns(), fixed_last_consumers_);
+      fixed_columns = absl::MakeConstSpan(owned_fixed_columns_);
+    }
+    advice_columns_ = CoeffsToQueriedExtendedPart(poly_table.advice_columns(),
+                                                  advice_last_consumers_);
+    instance_columns_ = CoeffsToQueriedExtendedPart(
+        poly_table.instance_columns(), instance_last_consumers_);
+    table_ = RefTable<Evals>(fixed_columns,
+                             absl::MakeConstSpan(advice_columns_),
+                             absl::MakeConstSpan(instance_columns_));
   }
 
   // not owned
   const Domain* domain_ = nullptr;
+  // not owned
+  const ExtendedDomain* extended_domain_ = nullptr;
 
   F one_ = F::One();
   F current_extended_omega_ = F::One();
@@ -403,18 +629,35 @@ class CircuitPolynomialBuilder {
   // not owned
   const std::vector<RefTable<Poly>>* poly_tables_;
 
-  Evals l_first_;
-  Evals l_last_;
-  Evals l_active_row_;
+  // not owned
+  const VanishingExtendedParts<Evals>* extended_parts_ = nullptr;
+
+  // These point to either an element of |extended_parts_| or the owned ones
+  // below, which are computed only if |extended_parts_| is not available.
+  const Evals* l_first_ = nullptr;
+  const Evals* l_last_ = nullptr;
+  const Evals* l_active_row_ = nullptr;
+  const std::vector<Evals>* permutation_cosets_ = nullptr;
+
+  Evals owned_l_first_;
+  Evals owned_l_last_;
+  Evals owned_l_active_row_;
+  std::vector<Evals> owned_permutation_cosets_;
 
   std::vector<Evals> permutation_product_cosets_;
-  std::vector<Evals> permutation_cosets_;
 
   std::vector<Evals> lookup_product_cosets_;
   std::vector<Evals> lookup_input_cosets_;
   std::vector<Evals> lookup_table_cosets_;
 
-  OwnedTable<Evals> table_;
+  std::vector<ColumnConsumer> fixed_last_consumers_;
+  std::vector<ColumnConsumer> advice_last_consumers_;
+  std::vector<ColumnConsumer> instance_last_consumers_;
+
+  std::vector<Evals> owned_fixed_columns_;
+  std::vector<Evals> advice_columns_;
+  std::vector<Evals> instance_columns_;
+  RefTable<Evals> table_;
 };
 
 }  // namespace tachyon::zk
@@ -76,6 +76,30 @@ class GraphEvaluator : public Evaluator<F, ValueSource> {
     return data.intermediates()[calculations_.back().target];
   }
 
+  // Sets |(*fixed_queried)[i]| to true if the i-th fixed column is read by
+  // |Evaluate()| above, and does the same for the advice and instance columns.
+  void MarkQueriedColumns(std::vector<bool>* fixed_queried,
+                          std::vector<bool>* advice_queried,
+                          std::vector<bool>* instance_queried) const {
+    for (const CalculationInfo& info : calculations_) {
+      for (const ValueSource& source : info.calculation.GetValueSources()) {
+        switch (source.type()) {
+          case ValueSource::Type::kFixed:
+            (*fixed_queried)[source.column_index()] = true;
+            break;
+          case ValueSource::Type::kAdvice:
+            (*advice_queried)[source.column_index()] = true;
+            break;
+          case ValueSource::Type::kInstance:
+            (*instance_queried)[source.column_index()] = true;
+            break;
+          default:
+            break;
+        }
+      }
+    }
+  }
+
   // Evaluator methods
   ValueSource Evaluate(const Expression<F>* input) override {
     switch (input->type()) {
@@ -130,6 +130,31 @@ TEST_F(GraphEvaluatorTest, Challenges) {
             CalculationInfo(Calculation::Store(ValueSource::Challenge(1)), 0));
 }
 
+TEST_F(GraphEvaluatorTest, MarkQueriedColumns) {
+  GraphEvaluator<GF7> graph_evaluator;
+  // a₁(ω¹X) * f₀(X) + i₂(X) + c
+  Expr expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Sum(
+          ExpressionFactory<GF7>::Product(
+              ExpressionFactory<GF7>::Advice(
+                  AdviceQuery(0, Rotation(1), AdviceColumnKey(1))),
+              ExpressionFactory<GF7>::Fixed(
+                  FixedQuery(0, Rotation::Cur(), FixedColumnKey(0)))),
+          ExpressionFactory<GF7>::Instance(
+              InstanceQuery(0, Rotation::Cur(), InstanceColumnKey(2)))),
+      ExpressionFactory<GF7>::Challenge(Challenge(0, Phase(0))));
+  graph_evaluator.Evaluate(expr.get());
+
+  std::vector<bool> fixed_queried(2);
+  std::vector<bool> advice_queried(3);
+  std::vector<bool> instance_queried(3);
+  graph_evaluator.MarkQueriedColumns(&fixed_queried, &advice_queried,
+                                     &instance_queried);
+  EXPECT_EQ(fixed_queried, std::vector<bool>({true, false}));
+  EXPECT_EQ(advice_queried, std::vector<bool>({false, true, false}));
+  EXPECT_EQ(instance_queried, std::vector<bool>({false, false, true}));
+}
+
 // TODO(chokobole): AddTest for Negated, Sum, Product and Scale.
 
 }  // namespace tachyon::zk
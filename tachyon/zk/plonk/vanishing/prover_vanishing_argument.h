@@ -49,32 +49,22 @@ template <typename PCSTy>
   return true;
 }
 
-template <typename PCSTy, typename ExtendedEvals>
-[[nodiscard]] bool CommitFinalHPoly(
+// Commits to the pieces of the quotient polynomial h(X), given its first
+// |prover->pcs().N()| * (cs_degree - 1) coefficients |h_coeffs|, which are
+// obtained by |VanishingArgument::BuildQuotientPolyCoeffs()|.
+template <typename PCSTy, typename F>
+[[nodiscard]] bool CommitFinalHPolyFromCoeffs(
     ProverBase<PCSTy>* prover,
     VanishingCommitted<EntityTy::kProver, PCSTy>&& committed,
-    const VerifyingKey<PCSTy>& vk, ExtendedEvals& circuit_column,
+    const VerifyingKey<PCSTy>& vk, std::vector<F>&& h_coeffs,
     VanishingConstructed<EntityTy::kProver, PCSTy>* constructed_out) {
-  using F = typename PCSTy::Field;
   using Poly = typename PCSTy::Poly;
   using Coeffs = typename Poly::Coefficients;
-  using ExtendedPoly = typename PCSTy::ExtendedPoly;
-
-  // Divide by t(X) = X^{params.n} - 1.
-  ExtendedEvals h_evals = DivideByVanishingPolyInPlace<F>(
-      circuit_column, prover->extended_domain(), prover->domain());
-
-  // Obtain final h(X) polynomial
-  ExtendedPoly h_poly =
-      ExtendedToCoeff<F, ExtendedPoly>(h_evals, prover->extended_domain());
+  using Commitment = typename PCSTy::Commitment;
 
-  // Truncate it to match the size of the quotient polynomial; the
-  // evaluation domain might be slightly larger than necessary because
-  // it always lies on a power-of-two boundary.
-  std::vector<F>& h_coeffs = h_poly.coefficients().coefficients();
   const size_t quotient_poly_degree =
       vk.constraint_system().ComputeDegree() - 1;
-  h_coeffs.resize(prover->pcs().N() * quotient_poly_degree, F::Zero());
+  CHECK_EQ(h_coeffs.size(), prover->pcs().N() * quotient_poly_degree);
 
   auto h_chunks = base::Chunked(h_coeffs, prover->pcs().N());
   std::vector<Poly> h_pieces = base::Map(
@@ -83,16 +73,20 @@ template <typename PCSTy, typename ExtendedEvals>
             Coeffs(std::move(std::vector<F>(h_piece.begin(), h_piece.end()))));
       });
 
-  // Compute commitments to each h(X) piece
+  // Compute commitments to each h(X) piece in parallel, and then write them to
+  // the proof at once in order.
+  std::vector<Commitment> commitments(h_pieces.size());
   std::vector<bool> results = base::ParallelizeMapByChunkSize(
       h_coeffs, prover->pcs().N(),
-      [prover](absl::Span<const F> h_piece, size_t chunk_index) {
-        return prover->Commit(h_piece);
+      [prover, &commitments](absl::Span<const F> h_piece, size_t chunk_index) {
+        return prover->pcs().DoCommit(h_piece, &commitments[chunk_index]);
       });
   if (std::any_of(results.begin(), results.end(),
                   [](bool result) { return result == false; })) {
     return false;
   }
+  if (!prover->GetWriter()->WriteManyToProof(absl::MakeConstSpan(commitments)))
+    return false;
 
   // FIXME(TomTaehoonKim): Remove this if possible.
   std::vector<F> h_blinds =
@@ -104,6 +98,35 @@ template <typename PCSTy, typename ExtendedEvals>
   return true;
 }
 
+template <typename PCSTy, typename ExtendedEvals>
+[[nodiscard]] bool CommitFinalHPoly(
+    ProverBase<PCSTy>* prover,
+    VanishingCommitted<EntityTy::kProver, PCSTy>&& committed,
+    const VerifyingKey<PCSTy>& vk, ExtendedEvals& circuit_column,
+    VanishingConstructed<EntityTy::kProver, PCSTy>* constructed_out) {
+  using F = typename PCSTy::Field;
+  using ExtendedPoly = typename PCSTy::ExtendedPoly;
+
+  // Divide by t(X) = X^{params.n} - 1.
+  ExtendedEvals h_evals = DivideByVanishingPolyInPlace<F>(
+      circuit_column, prover->extended_domain(), prover->domain());
+
+  // Obtain final h(X) polynomial
+  ExtendedPoly h_poly =
+      ExtendedToCoeff<F, ExtendedPoly>(h_evals, prover->extended_domain());
+
+  // Truncate it to match the size of the quotient polynomial; the
+  // evaluation domain might be slightly larger than necessary because
+  // it always lies on a power-of-two boundary.
+  std::vector<F>& h_coeffs = h_poly.coefficients().coefficients();
+  const size_t quotient_poly_degree =
+      vk.constraint_system().ComputeDegree() - 1;
+  h_coeffs.resize(prover->pcs().N() * quotient_poly_degree, F::Zero());
+
+  return CommitFinalHPolyFromCoeffs(prover, std::move(committed), vk,
+                                    std::move(h_coeffs), constructed_out);
+}
+
 template <typename PCSTy, typename F, typename Commitment>
 [[nodiscard]] bool CommitRandomEval(
     const PCSTy& pcs,
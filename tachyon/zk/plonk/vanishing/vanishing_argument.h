@@ -107,6 +107,39 @@ class VanishingArgument {
     return builder.BuildExtendedCircuitColumn(custom_gates_, lookups_);
   }
 
+  // Returns the coefficients of the quotient polynomial to be passed to
+  // |CommitFinalHPolyFromCoeffs()|. Unlike |BuildExtendedCircuitColumn()|,
+  // this streams each part of the extended domain to the coefficients. See
+  // |CircuitPolynomialBuilder::BuildQuotientPolyCoeffs()|.
+  //
+  // NOTE: This is what the prover should use to construct h(X). Building the
+  // extended circuit column and passing it to |CommitFinalHPoly()| gives the
+  // same commitments, but it holds the whole extended column and its
+  // coefficients in memory at once.
+  template <typename PCSTy, typename Poly = typename PCSTy::Poly>
+  std::vector<F> BuildQuotientPolyCoeffs(
+      ProverBase<PCSTy>* prover, const ProvingKey<PCSTy>& proving_key,
+      const F& beta, const F& gamma, const F& theta, const F& y, const F& zeta,
+      const std::vector<F>& challenges,
+      const std::vector<PermutationCommitted<Poly>>& committed_permutations,
+      const std::vector<std::vector<LookupCommitted<Poly>>>&
+          committed_lookups_vec,
+      const std::vector<RefTable<Poly>>& poly_tables) const {
+    size_t blinding_factors = prover->blinder().blinding_factors();
+    size_t cs_degree =
+        proving_key.verifying_key().constraint_system().ComputeDegree();
+
+    CircuitPolynomialBuilder<PCSTy> builder =
+        CircuitPolynomialBuilder<PCSTy>::Create(
+            prover->domain(), prover->extended_domain(), prover->pcs().N(),
+            blinding_factors, cs_degree, &beta, &gamma, &theta, &y, &zeta,
+            &challenges, &proving_key, &committed_permutations,
+            &committed_lookups_vec, &poly_tables);
+
+    return builder.BuildQuotientPolyCoeffs(
+        custom_gates_, lookups_, prover->pcs().N() * (cs_degree - 1));
+  }
+
  private:
   GraphEvaluator<F> custom_gates_;
   std::vector<GraphEvaluator<F>> lookups_;
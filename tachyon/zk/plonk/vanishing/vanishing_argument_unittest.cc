@@ -82,6 +82,163 @@ TEST_F(VanishingArgumentTest, BuildExtendedCircuitColumn) {
       committed_permutations, committed_lookups_vec, poly_tables);
 
   EXPECT_FALSE(circuit_column.IsZero());
+
+  // The precomputed parts of the proving key are not used for fixed columns
+  // other than its own.
+  pkey.PrecomputeVanishingExtendedParts(prover_.get(), zeta);
+  EXPECT_EQ(vanishing_argument.BuildExtendedCircuitColumn(
+                prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+                committed_permutations, committed_lookups_vec, poly_tables),
+            circuit_column);
+
+  // Streaming the parts gives the same quotient polynomial.
+  using ExtendedPoly = typename PCS::ExtendedPoly;
+  DivideByVanishingPolyInPlace<F>(circuit_column, prover_->extended_domain(),
+                                  prover_->domain());
+  ExtendedPoly h_poly = ExtendedToCoeff<F, ExtendedPoly>(
+      circuit_column, prover_->extended_domain());
+  std::vector<F>& expected = h_poly.coefficients().coefficients();
+  expected.resize(prover_->pcs().N() * (cs_degree - 1), F::Zero());
+  EXPECT_EQ(vanishing_argument.BuildQuotientPolyCoeffs(
+                prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+                committed_permutations, committed_lookups_vec, poly_tables),
+            expected);
+}
+
+TEST_F(VanishingArgumentTest, BuildExtendedCircuitColumnWithExtendedParts) {
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F> circuit(constant, a, b);
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+
+  std::vector<Poly> instance_columns = {GenRandomPoly()};
+  std::vector<Poly> advice_columns = {GenRandomPoly(), GenRandomPoly()};
+  RefTable<Poly> table(absl::MakeConstSpan(pkey.fixed_polys()),
+                       absl::MakeConstSpan(advice_columns),
+                       absl::MakeConstSpan(instance_columns));
+  std::vector<RefTable<Poly>> poly_tables = {table};
+
+  std::vector<F> challenges = base::CreateVector(0, F::Random());
+  F y = F::Random();
+  F beta = F::Random();
+  F gamma = F::Random();
+  F theta = F::Random();
+  F zeta = GetZeta<F>();
+
+  size_t cs_degree = pkey.verifying_key().constraint_system().ComputeDegree();
+  std::vector<PermutationCommitted<Poly>> committed_permutations =
+      base::CreateVector(1, [this, cs_degree]() {
+        std::vector<BlindedPolynomial<Poly>> product_polys =
+            base::CreateVector(cs_degree - 2, GenRandomBlindedPoly());
+        return PermutationCommitted<Poly>(std::move(product_polys));
+      });
+
+  std::vector<std::vector<LookupCommitted<Poly>>> committed_lookups_vec =
+      base::CreateVector(1, [this]() {
+        return base::CreateVector(0, [this]() {
+          return LookupCommitted<Poly>(GenRandomBlindedPoly(),
+                                       GenRandomBlindedPoly(),
+                                       GenRandomBlindedPoly());
+        });
+      });
+
+  VanishingArgument<F> vanishing_argument =
+      VanishingArgument<F>::Create(pkey.verifying_key().constraint_system());
+
+  ExtendedEvals circuit_column = vanishing_argument.BuildExtendedCircuitColumn(
+      prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+      committed_permutations, committed_lookups_vec, poly_tables);
+
+  EXPECT_FALSE(circuit_column.IsZero());
+
+  // The precomputed parts of the proving key are used only for the same zeta.
+  pkey.PrecomputeVanishingExtendedParts(prover_.get(), GetHalo2Zeta<F>());
+  EXPECT_EQ(vanishing_argument.BuildExtendedCircuitColumn(
+                prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+                committed_permutations, committed_lookups_vec, poly_tables),
+            circuit_column);
+
+  pkey.PrecomputeVanishingExtendedParts(prover_.get(), zeta);
+  EXPECT_EQ(vanishing_argument.BuildExtendedCircuitColumn(
+                prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+                committed_permutations, committed_lookups_vec, poly_tables),
+            circuit_column);
+}
+
+TEST_F(VanishingArgumentTest, ReloadDropsExtendedParts) {
+  F a(2);
+  F b(3);
+  SimpleCircuit<F> circuit(F(7), a, b);
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+  F zeta = GetZeta<F>();
+  pkey.PrecomputeVanishingExtendedParts(prover_.get(), zeta);
+  F transcript_repr = pkey.verifying_key().transcript_repr();
+
+  // Reloading the key for another circuit of the same shape drops the parts.
+  SimpleCircuit<F> other_circuit(F(8), a, b);
+  ASSERT_TRUE(pkey.Load(prover_.get(), other_circuit));
+  EXPECT_TRUE(pkey.vanishing_extended_parts().IsEmpty());
+
+  std::vector<Poly> instance_columns = {GenRandomPoly()};
+  std::vector<Poly> advice_columns = {GenRandomPoly(), GenRandomPoly()};
+  RefTable<Poly> table(absl::MakeConstSpan(pkey.fixed_polys()),
+                       absl::MakeConstSpan(advice_columns),
+                       absl::MakeConstSpan(instance_columns));
+  std::vector<RefTable<Poly>> poly_tables = {table};
+
+  std::vector<F> challenges = base::CreateVector(0, F::Random());
+  F y = F::Random();
+  F beta = F::Random();
+  F gamma = F::Random();
+  F theta = F::Random();
+
+  size_t cs_degree = pkey.verifying_key().constraint_system().ComputeDegree();
+  std::vector<PermutationCommitted<Poly>> committed_permutations =
+      base::CreateVector(1, [this, cs_degree]() {
+        std::vector<BlindedPolynomial<Poly>> product_polys =
+            base::CreateVector(cs_degree - 2, GenRandomBlindedPoly());
+        return PermutationCommitted<Poly>(std::move(product_polys));
+      });
+  std::vector<std::vector<LookupCommitted<Poly>>> committed_lookups_vec(1);
+
+  VanishingArgument<F> vanishing_argument =
+      VanishingArgument<F>::Create(pkey.verifying_key().constraint_system());
+
+  ExtendedEvals circuit_column = vanishing_argument.BuildExtendedCircuitColumn(
+      prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+      committed_permutations, committed_lookups_vec, poly_tables);
+
+  // Parts that differ from the ones of the key change the circuit column if
+  // they are used, but the parts of the previous key are not used even if they
+  // are set back.
+  std::vector<Poly> polys = base::CreateVector(
+      pkey.fixed_polys().size() +
+          pkey.permutation_proving_key().polys().size(),
+      [this]() { return GenRandomPoly(); });
+  auto create_parts = [this, &zeta, &polys, &pkey](const F& transcript_repr) {
+    return VanishingExtendedParts<Evals>::Create(
+        prover_->domain(), prover_->extended_domain(), transcript_repr, zeta,
+        GenRandomPoly(), GenRandomPoly(), GenRandomPoly(),
+        absl::MakeConstSpan(polys).subspan(0, pkey.fixed_polys().size()),
+        absl::MakeConstSpan(polys).subspan(pkey.fixed_polys().size()));
+  };
+  pkey.set_vanishing_extended_parts(
+      create_parts(pkey.verifying_key().transcript_repr()));
+  EXPECT_NE(vanishing_argument.BuildExtendedCircuitColumn(
+                prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+                committed_permutations, committed_lookups_vec, poly_tables),
+            circuit_column);
+
+  pkey.set_vanishing_extended_parts(create_parts(transcript_repr));
+  EXPECT_EQ(vanishing_argument.BuildExtendedCircuitColumn(
+                prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+                committed_permutations, committed_lookups_vec, poly_tables),
+            circuit_column);
 }
 
 TEST_F(VanishingArgumentTest, VanishingArgument) {
@@ -0,0 +1,191 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_VANISHING_EXTENDED_PARTS_H_
+#define TACHYON_ZK_PLONK_VANISHING_VANISHING_EXTENDED_PARTS_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
+
+namespace tachyon {
+namespace zk {
+
+// |VanishingExtendedParts| holds the evaluations over each part of the
+// extended domain of the polynomials that only depend on the proving key, i.e.,
+// l_first, l_last, l_active_row, the fixed polynomials and the permutation
+// polynomials. See |CircuitPolynomialBuilder| for how the extended domain is
+// split into parts. Since they are the same for every proof, holding them saves
+// the prover (3 + #fixed + #permutation) FFTs per part, at the cost of as many
+// evaluations as the size of the extended domain per polynomial. They are
+// bound to the proving key they are computed from by its
+// |VerifyingKey::transcript_repr()|.
+template <typename Evals>
+class VanishingExtendedParts {
+ public:
+  using F = typename Evals::Field;
+
+  VanishingExtendedParts() = default;
+  VanishingExtendedParts(const F& transcript_repr, const F& zeta,
+                         std::vector<Evals>&& l_first_parts,
+                         std::vector<Evals>&& l_last_parts,
+                         std::vector<Evals>&& l_active_row_parts,
+                         std::vector<std::vector<Evals>>&& fixed_columns_parts,
+                         std::vector<std::vector<Evals>>&& permutations_parts)
+      : transcript_repr_(transcript_repr),
+        zeta_(zeta),
+        l_first_parts_(std::move(l_first_parts)),
+        l_last_parts_(std::move(l_last_parts)),
+        l_active_row_parts_(std::move(l_active_row_parts)),
+        fixed_columns_parts_(std::move(fixed_columns_parts)),
+        permutations_parts_(std::move(permutations_parts)) {
+    CHECK_EQ(l_first_parts_.size(), l_last_parts_.size());
+    CHECK_EQ(l_first_parts_.size(), l_active_row_parts_.size());
+    CHECK_EQ(l_first_parts_.size(), fixed_columns_parts_.size());
+    CHECK_EQ(l_first_parts_.size(), permutations_parts_.size());
+  }
+
+  // Computes the evaluations over the cosets ζ * ω_extⁱ * H of |domain| H,
+  // where ω_ext is the generator of |extended_domain|. |transcript_repr| is
+  // the one of the verifying key that the polynomials belong to.
+  template <typename Domain, typename ExtendedDomain, typename Poly>
+  static VanishingExtendedParts Create(
+      const Domain* domain, const ExtendedDomain* extended_domain,
+      const F& transcript_repr, const F& zeta, const Poly& l_first,
+      const Poly& l_last, const Poly& l_active_row,
+      absl::Span<const Poly> fixed_polys,
+      absl::Span<const Poly> permutation_polys) {
+    size_t num_parts = extended_domain->size() >> domain->log_size_of_group();
+    std::vector<Evals> l_first_parts;
+    std::vector<Evals> l_last_parts;
+    std::vector<Evals> l_active_row_parts;
+    std::vector<std::vector<Evals>> fixed_columns_parts;
+    std::vector<std::vector<Evals>> permutations_parts;
+    l_first_parts.reserve(num_parts);
+    l_last_parts.reserve(num_parts);
+    l_active_row_parts.reserve(num_parts);
+    fixed_columns_parts.reserve(num_parts);
+    permutations_parts.reserve(num_parts);
+
+    F extended_omega_factor = F::One();
+    for (size_t i = 0; i < num_parts; ++i) {
+      l_first_parts.push_back(
+          CoeffToExtendedPart(domain, l_first, zeta, extended_omega_factor));
+      l_last_parts.push_back(
+          CoeffToExtendedPart(domain, l_last, zeta, extended_omega_factor));
+      l_active_row_parts.push_back(CoeffToExtendedPart(
+          domain, l_active_row, zeta, extended_omega_factor));
+      fixed_columns_parts.push_back(CoeffsToExtendedPart(
+          domain, fixed_polys, zeta, extended_omega_factor));
+      permutations_parts.push_back(CoeffsToExtendedPart(
+          domain, permutation_polys, zeta, extended_omega_factor));
+      extended_omega_factor *= extended_domain->group_gen();
+    }
+    return VanishingExtendedParts(
+        transcript_repr, zeta, std::move(l_first_parts),
+        std::move(l_last_parts), std::move(l_active_row_parts),
+        std::move(fixed_columns_parts), std::move(permutations_parts));
+  }
+
+  const F& transcript_repr() const { return transcript_repr_; }
+  const F& zeta() const { return zeta_; }
+  const std::vector<Evals>& l_first_parts() const { return l_first_parts_; }
+  const std::vector<Evals>& l_last_parts() const { return l_last_parts_; }
+  const std::vector<Evals>& l_active_row_parts() const {
+    return l_active_row_parts_;
+  }
+  const std::vector<std::vector<Evals>>& fixed_columns_parts() const {
+    return fixed_columns_parts_;
+  }
+  const std::vector<std::vector<Evals>>& permutations_parts() const {
+    return permutations_parts_;
+  }
+
+  size_t NumParts() const { return l_first_parts_.size(); }
+
+  bool IsEmpty() const { return l_first_parts_.empty(); }
+
+  // Returns true if these can be used in place of the evaluations over the
+  // |num_parts| parts with |zeta| of the key whose transcript representation
+  // is |transcript_repr|.
+  bool CanBeUsedFor(const F& transcript_repr, const F& zeta,
+                    size_t num_parts) const {
+    return !IsEmpty() && transcript_repr_ == transcript_repr &&
+           zeta_ == zeta && NumParts() == num_parts;
+  }
+
+ private:
+  F transcript_repr_;
+  F zeta_;
+  std::vector<Evals> l_first_parts_;
+  std::vector<Evals> l_last_parts_;
+  std::vector<Evals> l_active_row_parts_;
+  std::vector<std::vector<Evals>> fixed_columns_parts_;
+  std::vector<std::vector<Evals>> permutations_parts_;
+};
+
+}  // namespace zk
+
+namespace base {
+
+template <typename Evals>
+class Copyable<zk::VanishingExtendedParts<Evals>> {
+ public:
+  using F = typename Evals::Field;
+
+  static bool WriteTo(const zk::VanishingExtendedParts<Evals>& parts,
+                      Buffer* buffer) {
+    return buffer->WriteMany(parts.transcript_repr(), parts.zeta(),
+                             parts.l_first_parts(), parts.l_last_parts(),
+                             parts.l_active_row_parts(),
+                             parts.fixed_columns_parts(),
+                             parts.permutations_parts());
+  }
+
+  static bool ReadFrom(const Buffer& buffer,
+                       zk::VanishingExtendedParts<Evals>* parts) {
+    F transcript_repr;
+    F zeta;
+    std::vector<Evals> l_first_parts;
+    std::vector<Evals> l_last_parts;
+    std::vector<Evals> l_active_row_parts;
+    std::vector<std::vector<Evals>> fixed_columns_parts;
+    std::vector<std::vector<Evals>> permutations_parts;
+    if (!buffer.ReadMany(&transcript_repr, &zeta, &l_first_parts,
+                         &l_last_parts, &l_active_row_parts,
+                         &fixed_columns_parts, &permutations_parts))
+      return false;
+    if (l_last_parts.size() != l_first_parts.size() ||
+        l_active_row_parts.size() != l_first_parts.size() ||
+        fixed_columns_parts.size() != l_first_parts.size() ||
+        permutations_parts.size() != l_first_parts.size()) {
+      LOG(ERROR) << "Number of parts do not match";
+      return false;
+    }
+
+    *parts = zk::VanishingExtendedParts<Evals>(
+        transcript_repr, zeta, std::move(l_first_parts),
+        std::move(l_last_parts), std::move(l_active_row_parts),
+        std::move(fixed_columns_parts), std::move(permutations_parts));
+    return true;
+  }
+
+  static size_t EstimateSize(const zk::VanishingExtendedParts<Evals>& parts) {
+    return base::EstimateSize(parts.transcript_repr()) +
+           base::EstimateSize(parts.zeta()) +
+           base::EstimateSize(parts.l_first_parts()) +
+           base::EstimateSize(parts.l_last_parts()) +
+           base::EstimateSize(parts.l_active_row_parts()) +
+           base::EstimateSize(parts.fixed_columns_parts()) +
+           base::EstimateSize(parts.permutations_parts());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_VANISHING_EXTENDED_PARTS_H_
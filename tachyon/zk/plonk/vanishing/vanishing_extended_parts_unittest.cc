@@ -0,0 +1,117 @@
+#include "tachyon/zk/plonk/vanishing/vanishing_extended_parts.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+class VanishingExtendedPartsTest : public testing::Test {
+ public:
+  constexpr static size_t N = size_t{1} << 4;
+  constexpr static size_t kMaxDegree = N - 1;
+  constexpr static size_t kNumParts = 4;
+  constexpr static size_t kMaxExtendedDegree = kNumParts * N - 1;
+
+  using F = math::bn254::Fr;
+  using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+  using ExtendedDomain =
+      math::UnivariateEvaluationDomain<F, kMaxExtendedDegree>;
+  using Poly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  void SetUp() override {
+    domain_ = Domain::Create(N);
+    extended_domain_ = ExtendedDomain::Create(kNumParts * N);
+    polys_ =
+        base::CreateVector(8, [this]() { return domain_->Random<Poly>(); });
+    transcript_repr_ = F::Random();
+  }
+
+ protected:
+  VanishingExtendedParts<Evals> CreateParts(const F& zeta) const {
+    return VanishingExtendedParts<Evals>::Create(
+        domain_.get(), extended_domain_.get(), transcript_repr_, zeta,
+        polys_[0], polys_[1], polys_[2],
+        absl::MakeConstSpan(polys_).subspan(3, 3),
+        absl::MakeConstSpan(polys_).subspan(6, 2));
+  }
+
+  std::unique_ptr<Domain> domain_;
+  std::unique_ptr<ExtendedDomain> extended_domain_;
+  std::vector<Poly> polys_;
+  F transcript_repr_;
+};
+
+}  // namespace
+
+TEST_F(VanishingExtendedPartsTest, Create) {
+  F zeta = GetZeta<F>();
+  VanishingExtendedParts<Evals> parts = CreateParts(zeta);
+
+  ASSERT_EQ(parts.NumParts(), kNumParts);
+  EXPECT_EQ(parts.transcript_repr(), transcript_repr_);
+  EXPECT_EQ(parts.zeta(), zeta);
+  F extended_omega_factor = F::One();
+  for (size_t i = 0; i < kNumParts; ++i) {
+    auto expected = [this, &zeta, &extended_omega_factor](size_t poly_idx) {
+      return CoeffToExtendedPart(domain_.get(), polys_[poly_idx], zeta,
+                                 extended_omega_factor);
+    };
+    EXPECT_EQ(parts.l_first_parts()[i], expected(0));
+    EXPECT_EQ(parts.l_last_parts()[i], expected(1));
+    EXPECT_EQ(parts.l_active_row_parts()[i], expected(2));
+    ASSERT_EQ(parts.fixed_columns_parts()[i].size(), 3);
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_EQ(parts.fixed_columns_parts()[i][j], expected(3 + j));
+    }
+    ASSERT_EQ(parts.permutations_parts()[i].size(), 2);
+    for (size_t j = 0; j < 2; ++j) {
+      EXPECT_EQ(parts.permutations_parts()[i][j], expected(6 + j));
+    }
+    extended_omega_factor *= extended_domain_->group_gen();
+  }
+}
+
+TEST_F(VanishingExtendedPartsTest, CanBeUsedFor) {
+  F zeta = GetZeta<F>();
+  EXPECT_FALSE(VanishingExtendedParts<Evals>().CanBeUsedFor(transcript_repr_,
+                                                            zeta, kNumParts));
+
+  VanishingExtendedParts<Evals> parts = CreateParts(zeta);
+  EXPECT_TRUE(parts.CanBeUsedFor(transcript_repr_, zeta, kNumParts));
+  EXPECT_FALSE(
+      parts.CanBeUsedFor(transcript_repr_ + F::One(), zeta, kNumParts));
+  EXPECT_FALSE(
+      parts.CanBeUsedFor(transcript_repr_, GetHalo2Zeta<F>(), kNumParts));
+  EXPECT_FALSE(parts.CanBeUsedFor(transcript_repr_, zeta, kNumParts / 2));
+}
+
+TEST_F(VanishingExtendedPartsTest, Copyable) {
+  VanishingExtendedParts<Evals> expected = CreateParts(GetZeta<F>());
+
+  base::Uint8VectorBuffer buf;
+  ASSERT_TRUE(buf.Write(expected));
+  EXPECT_EQ(buf.buffer_offset(), base::EstimateSize(expected));
+
+  buf.set_buffer_offset(0);
+  VanishingExtendedParts<Evals> value;
+  ASSERT_TRUE(buf.Read(&value));
+
+  EXPECT_EQ(value.transcript_repr(), expected.transcript_repr());
+  EXPECT_EQ(value.zeta(), expected.zeta());
+  EXPECT_EQ(value.l_first_parts(), expected.l_first_parts());
+  EXPECT_EQ(value.l_last_parts(), expected.l_last_parts());
+  EXPECT_EQ(value.l_active_row_parts(), expected.l_active_row_parts());
+  EXPECT_EQ(value.fixed_columns_parts(), expected.fixed_columns_parts());
+  EXPECT_EQ(value.permutations_parts(), expected.permutations_parts());
+}
+
+}  // namespace tachyon::zk
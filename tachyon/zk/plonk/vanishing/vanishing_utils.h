@@ -7,11 +7,14 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_VANISHING_UTILS_H_
 #define TACHYON_ZK_PLONK_VANISHING_VANISHING_UTILS_H_
 
+#include <algorithm>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
@@ -40,15 +43,13 @@ constexpr F GetHalo2Zeta() {
   return GetZeta<F>().Square();
 }
 
-// This divides the polynomial (in the extended domain) by the vanishing
-// polynomial of the 2ᵏ size domain.
-template <typename F, typename Domain, typename ExtendedDomain,
-          typename ExtendedEvals>
-ExtendedEvals& DivideByVanishingPolyInPlace(
-    ExtendedEvals& evals, const ExtendedDomain* extended_domain,
-    const Domain* domain) {
-  CHECK_EQ(evals.NumElements(), extended_domain->size());
-
+// Returns the inverses of the evaluations of the vanishing polynomial of the
+// 2ᵏ size domain over the extended domain. Since they repeat, only as many as
+// the number of parts of the extended domain are returned, where the i-th one
+// is the inverse of the evaluations over the i-th part.
+template <typename F, typename Domain, typename ExtendedDomain>
+std::vector<F> ComputeVanishingPolyInverses(
+    const ExtendedDomain* extended_domain, const Domain* domain) {
   const F zeta = GetHalo2Zeta<F>();
 
   // Compute the evaluations of t(X) = Xⁿ - 1 in the coset evaluation domain.
@@ -80,6 +81,20 @@ ExtendedEvals& DivideByVanishingPolyInPlace(
   });
 
   F::BatchInverseInPlace(t_evaluations);
+  return t_evaluations;
+}
+
+// This divides the polynomial (in the extended domain) by the vanishing
+// polynomial of the 2ᵏ size domain.
+template <typename F, typename Domain, typename ExtendedDomain,
+          typename ExtendedEvals>
+ExtendedEvals& DivideByVanishingPolyInPlace(
+    ExtendedEvals& evals, const ExtendedDomain* extended_domain,
+    const Domain* domain) {
+  CHECK_EQ(evals.NumElements(), extended_domain->size());
+
+  const std::vector<F> t_evaluations =
+      ComputeVanishingPolyInverses<F>(extended_domain, domain);
 
   // Multiply the inverse to obtain the quotient polynomial in the coset
   // evaluation domain.
@@ -157,6 +172,50 @@ ExtendedPoly ExtendedToCoeff(const ExtendedEvals& evals,
   return poly;
 }
 
+// Adds |scale| times the contribution of |part|, the evaluations over the
+// |part_idx|-th part of the extended domain, to |coeffs|, the first
+// coefficients of the polynomial that |extended_domain->IFFT()| returns for
+// the whole extended evaluations. Accumulating it for every part gives the
+// same coefficients without materializing the extended evaluations.
+//
+// With m = P * n, where P is the number of parts and n is the size of
+// |domain|, and the k = (j * P + i)-th extended evaluation being the j-th
+// evaluation of the i-th part, the l-th coefficient is
+//   cₗ = (1 / m) * Σₖ eₖ * ω_ext⁻ᵏˡ
+//      = (1 / P) * Σᵢ ω_ext⁻ⁱˡ * ((1 / n) * Σⱼ e_{j * P + i} * ω⁻ʲˡ),
+// where the inner sum is the (l mod n)-th coefficient of |domain->IFFT(part)|.
+template <typename F, typename Domain, typename ExtendedDomain, typename Evals>
+void AccumulateExtendedPartToCoeffs(const Domain* domain,
+                                    const ExtendedDomain* extended_domain,
+                                    const Evals& part, size_t part_idx,
+                                    const F& scale, absl::Span<F> coeffs) {
+  size_t n = domain->size();
+  size_t num_parts = extended_domain->size() >> domain->log_size_of_group();
+  CHECK_LT(part_idx, num_parts);
+  CHECK_LE(coeffs.size(), extended_domain->size());
+
+  // ω_ext⁻ⁱ
+  const F omega_inv = extended_domain->group_gen_inv().Pow(part_idx);
+  typename Domain::DensePoly poly = domain->IFFT(part);
+  // Multiply the r-th coefficient by ω_ext⁻ⁱʳ, so that only ω_ext⁻ⁱⁿᵇ, which
+  // is the same for every coefficient of the b-th block of size n, is left to
+  // be multiplied for l = b * n + r.
+  Domain::DistributePowers(poly, omega_inv);
+  const std::vector<F>& part_coeffs = poly.coefficients().coefficients();
+
+  const F omega_inv_pow_n = omega_inv.Pow(n);
+  F factor = scale * F(num_parts).Inverse();
+  for (size_t start = 0; start < coeffs.size(); start += n) {
+    absl::Span<F> block = coeffs.subspan(start, n);
+    // NOTE: |part_coeffs| has no trailing zeros.
+    size_t size = std::min(block.size(), part_coeffs.size());
+    OPENMP_PARALLEL_FOR(size_t r = 0; r < size; ++r) {
+      block[r] += factor * part_coeffs[r];
+    }
+    factor *= omega_inv_pow_n;
+  }
+}
+
 template <typename Domain, typename Poly, typename F,
           typename Evals = typename Domain::Evals>
 Evals CoeffToExtendedPart(const Domain* domain,
@@ -181,12 +240,38 @@ template <typename Domain, typename Poly, typename F,
 std::vector<Evals> CoeffsToExtendedPart(const Domain* domain,
                                         absl::Span<Poly> polys, const F& zeta,
                                         const F& extended_omega_factor) {
-  return base::Map(
-      polys, [domain, &zeta, &extended_omega_factor](const Poly& poly) {
-        return CoeffToExtendedPart(domain, poly, zeta, extended_omega_factor);
-      });
+  if constexpr (std::is_same_v<std::remove_const_t<Poly>,
+                               typename Domain::DensePoly>) {
+    // Distributing the powers of |zeta| * |extended_omega_factor| to the
+    // coefficients before the FFT is the same as the FFT over the coset of
+    // |domain| shifted by it. This way, the FFTs are batched without cloning
+    // |polys|.
+    auto coset =
+        domain->GetCoset(domain->offset() * zeta * extended_omega_factor);
+    return coset->FFTBatch(absl::MakeConstSpan(polys));
+  } else {
+    return base::Map(
+        polys, [domain, &zeta, &extended_omega_factor](const Poly& poly) {
+          return CoeffToExtendedPart(domain, poly, zeta,
+                                     extended_omega_factor);
+        });
+  }
+}
+
+// Writes |part| to every |num_parts|-th element of |extended| starting at
+// |part_idx|, i.e., |extended[j * num_parts + part_idx]| = |part[j]|.
+template <typename F>
+void InterleaveExtendedPart(absl::Span<const F> part, size_t part_idx,
+                            size_t num_parts, absl::Span<F> extended) {
+  CHECK_LT(part_idx, num_parts);
+  CHECK_EQ(extended.size(), part.size() * num_parts);
+  OPENMP_PARALLEL_FOR(size_t j = 0; j < part.size(); ++j) {
+    extended[j * num_parts + part_idx] = part[j];
+  }
 }
 
+// Interleaves |columns| into a single column, i.e., the j-th row of the i-th
+// column is written to the (j * |columns.size()| + i)-th element.
 template <typename F>
 std::vector<F> BuildExtendedColumnWithColumns(
     std::vector<std::vector<F>>&& columns) {
@@ -194,26 +279,13 @@ std::vector<F> BuildExtendedColumnWithColumns(
   size_t cols = columns.size();
   size_t rows = columns[0].size();
 
-  std::vector<std::vector<F>> transposed = base::CreateVector(
-      rows, [cols]() { return base::CreateVector(cols, F::Zero()); });
-  for (size_t i = 0; i < columns.size(); ++i) {
-    base::Parallelize(transposed, [i, &src_column = columns[i]](
-                                      absl::Span<std::vector<F>> dst_columns,
-                                      size_t chunk_idx, size_t chunk_size) {
-      size_t start = chunk_idx * chunk_size;
-      for (size_t j = 0; j < dst_columns.size(); ++j) {
-        dst_columns[j][i] = src_column[start + j];
-      }
-    });
-  }
-  std::vector<F> flattened_columns;
-  flattened_columns.reserve(cols * rows);
-  for (std::vector<F>& column : transposed) {
-    flattened_columns.insert(flattened_columns.end(),
-                             std::make_move_iterator(column.begin()),
-                             std::make_move_iterator(column.end()));
+  std::vector<F> extended(cols * rows);
+  for (size_t i = 0; i < cols; ++i) {
+    CHECK_EQ(columns[i].size(), rows);
+    InterleaveExtendedPart(absl::MakeConstSpan(columns[i]), i, cols,
+                           absl::MakeSpan(extended));
   }
-  return flattened_columns;
+  return extended;
 }
 
 }  // namespace tachyon::zk
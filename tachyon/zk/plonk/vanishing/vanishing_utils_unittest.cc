@@ -66,13 +66,14 @@ TEST_F(VanishingUtilsTest, CoeffToExtendedPart) {
 
 TEST_F(VanishingUtilsTest, BuildExtendedColumnWithColumns) {
   base::Range<size_t> range = base::Range<size_t>::Until(4);
-  std::vector<std::vector<F>> columns =
-      base::Map(range, [](size_t i) { return base::CreateVector(N, F(i)); });
+  std::vector<std::vector<F>> columns = base::Map(range, [](size_t i) {
+    return base::CreateVector(N, [i](size_t j) { return F(i * N + j); });
+  });
 
   std::vector<F> extended = BuildExtendedColumnWithColumns(std::move(columns));
   EXPECT_EQ(extended.size(), 4 * N);
   for (size_t i = 0; i < extended.size(); ++i) {
-    EXPECT_EQ(F(i % 4), extended[i]);
+    EXPECT_EQ(F(i % 4 * N + i / 4), extended[i]);
   }
 }
 
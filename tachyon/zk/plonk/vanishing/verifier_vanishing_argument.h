@@ -10,6 +10,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/ref.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -45,8 +47,8 @@ template <typename PCSTy, typename Commitment>
   std::vector<Commitment> h_commitments;
   size_t quotient_poly_degree = vk.constraint_system().ComputeDegree() - 1;
   h_commitments.resize(quotient_poly_degree);
-  for (Commitment& commitment : h_commitments) {
-    if (!transcript->ReadFromProof(&commitment)) return false;
+  if (!transcript->ReadManyFromProof(absl::MakeSpan(h_commitments))) {
+    return false;
   }
 
   *constructed_out = {std::move(h_commitments),